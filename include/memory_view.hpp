@@ -33,12 +33,35 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <exception>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if __has_include(<version>)
+#include <version>
+#endif /* __has_include(<version>) */
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif /* defined(__cpp_lib_ranges) */
+
+#if defined(__GNUC__)
+#define MEMORY_VIEW_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define MEMORY_VIEW_UNLIKELY(x) (x)
+#endif /* defined(__GNUC__) */
+
+#if !defined(MEMORY_VIEW_CHECKING)
+#define MEMORY_VIEW_CHECKING unchecked
+#endif /* !defined(MEMORY_VIEW_CHECKING) */
+
 namespace memory_view{
     namespace impl{
         [[noreturn]] inline void throw_out_of_range(const char* s){
@@ -49,9 +72,104 @@ namespace memory_view{
             std::terminate();
 #endif /* defined(__cpp_exceptions) */
         }
+
+        [[noreturn]] inline void trap()noexcept{
+#if defined(__GNUC__)
+            __builtin_trap();
+#else
+            std::abort();
+#endif /* defined(__GNUC__) */
+        }
     }
 
-    template<typename T>
+    template<typename T, typename Checking>
+    class memory_view;
+
+    namespace impl{
+        template<typename T>
+        struct is_memory_view : std::false_type{};
+        template<typename T, typename C>
+        struct is_memory_view<memory_view<T, C>> : std::true_type{};
+
+        template<typename T>
+        inline constexpr bool is_char_v =
+            std::is_same_v<T, char> ||
+            std::is_same_v<T, wchar_t> ||
+#if defined(__cpp_char8_t)
+            std::is_same_v<T, char8_t> ||
+#endif /* defined(__cpp_char8_t) */
+            std::is_same_v<T, char16_t> ||
+            std::is_same_v<T, char32_t>;
+
+#if defined(__cpp_lib_ranges)
+        template<typename R, typename T>
+        concept compatible_range =
+            std::ranges::contiguous_range<R> &&
+            std::ranges::sized_range<R> &&
+            (std::is_lvalue_reference_v<R> || std::ranges::borrowed_range<R>) &&
+            std::is_convertible_v<std::remove_reference_t<std::ranges::range_reference_t<R>>(*)[], T(*)[]>;
+
+        template<typename R, typename T>
+        inline constexpr bool is_compatible_range_v =
+            !is_memory_view<std::remove_cvref_t<R>>::value && compatible_range<R, T>;
+#else
+        // ranges that do not own their elements and may be viewed as rvalues
+        template<typename R>
+        struct is_borrowed : std::false_type{};
+        template<typename CharT, typename Traits>
+        struct is_borrowed<std::basic_string_view<CharT, Traits>> : std::true_type{};
+
+        template<typename R, typename T, typename = void>
+        struct is_compatible_range : std::false_type{};
+        template<typename R, typename T>
+        struct is_compatible_range<R, T, std::void_t<decltype(std::data(std::declval<R&>())),
+                                                     decltype(std::size(std::declval<R&>()))>>
+            : std::bool_constant<
+            (std::is_lvalue_reference_v<R> || is_borrowed<std::remove_cv_t<R>>::value) &&
+            std::is_convertible_v<std::remove_pointer_t<decltype(std::data(std::declval<R&>()))>(*)[], T(*)[]>>{};
+
+        template<typename R, typename T>
+        inline constexpr bool is_compatible_range_v =
+            !is_memory_view<std::remove_cv_t<std::remove_reference_t<R>>>::value &&
+            is_compatible_range<R, T>::value;
+#endif /* defined(__cpp_lib_ranges) */
+    }
+
+    // bounds checking policies for operator[], front(), back(),
+    // remove_prefix() and remove_suffix(), at() and view() always check
+    namespace checking{
+        // no checks at all, out of range access is undefined behaviour
+        struct unchecked{
+            static constexpr bool nothrow = true;
+
+            static constexpr void require(bool, const char*)noexcept{}
+        };
+
+        // trap on violation, never throws
+        struct hardened{
+            static constexpr bool nothrow = true;
+
+            static constexpr void require(bool ok, const char*)noexcept{
+                if(MEMORY_VIEW_UNLIKELY(!ok))
+                    impl::trap();
+            }
+        };
+
+        // throw std::out_of_range on violation (or terminate without exceptions)
+        struct checked{
+            static constexpr bool nothrow = false;
+
+            static constexpr void require(bool ok, const char* s){
+                if(MEMORY_VIEW_UNLIKELY(!ok))
+                    impl::throw_out_of_range(s);
+            }
+        };
+    }
+
+    template<typename T, typename Checking = checking::MEMORY_VIEW_CHECKING>
+    class memory_view;
+
+    template<typename T, typename Checking>
     class memory_view{
         T*          _data;
         std::size_t _size;
@@ -69,9 +187,14 @@ namespace memory_view{
         using const_iterator         = const_pointer;
         using reverse_iterator       = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using checking_policy        = Checking;
 
         static const size_type npos  = std::numeric_limits<size_type>::max();
 
+        constexpr memory_view()noexcept:
+            _data{nullptr},
+            _size{0}{}
+
         constexpr memory_view(const memory_view& other) = default;
         constexpr memory_view(memory_view&& other) = default;
 
@@ -86,23 +209,22 @@ namespace memory_view{
         // construct from begin and end pointer
         constexpr memory_view(pointer begin, pointer end):
             _data{begin},
-            _size{end - begin}{}
-
-        // construct from std::array
-        template<std::size_t N>
-        constexpr memory_view(std::array<T, N>& arr):
-            _data{arr.data()},
-            _size{N}{}
+            _size{static_cast<size_type>(end - begin)}{}
 
-        // construct from std::vector
-        constexpr memory_view(std::vector<T>& vec):
-            _data{vec.data()},
-            _size{vec.size()}{}
+        // construct from any contiguous sized range,
+        // e.g. std::array, std::vector, std::string, std::string_view, std::span or C arrays
+        template<typename R,
+                 typename = std::enable_if_t<impl::is_compatible_range_v<R, T>>>
+        constexpr memory_view(R&& range)noexcept(noexcept(std::data(range)) && noexcept(std::size(range))):
+            _data{std::data(range)},
+            _size{static_cast<size_type>(std::size(range))}{}
 
-        // construct from std::string
-        constexpr memory_view(std::basic_string<T>& str):
-            _data{str.data()},
-            _size{str.size()}{}
+        // construct from a memory_view with a convertible element type or other checking policy
+        template<typename U, typename C,
+                 typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr memory_view(memory_view<U, C> other)noexcept:
+            _data{other.data()},
+            _size{other.size()}{}
 
         void swap(memory_view& other)noexcept{
             using std::swap;
@@ -172,10 +294,12 @@ namespace memory_view{
         }
 
         // element access:
-        constexpr reference operator[](size_type n)noexcept{
+        constexpr reference operator[](size_type n)noexcept(Checking::nothrow){
+            Checking::require(n < size(), "memory_view::operator[]");
             return _data[n];
         }
-        constexpr const_reference operator[](size_type n)const noexcept{
+        constexpr const_reference operator[](size_type n)const noexcept(Checking::nothrow){
+            Checking::require(n < size(), "memory_view::operator[]");
             return _data[n];
         }
         constexpr reference at(size_type n){
@@ -189,16 +313,20 @@ namespace memory_view{
             return _data[n];
         }
 
-        constexpr reference front()noexcept{
+        constexpr reference front()noexcept(Checking::nothrow){
+            Checking::require(!empty(), "memory_view::front");
             return _data[0];
         }
-        constexpr const_reference front()const noexcept{
+        constexpr const_reference front()const noexcept(Checking::nothrow){
+            Checking::require(!empty(), "memory_view::front");
             return _data[0];
         }
-        constexpr reference back()noexcept{
+        constexpr reference back()noexcept(Checking::nothrow){
+            Checking::require(!empty(), "memory_view::back");
             return _data[size() - 1];
         }
-        constexpr const_reference back()const noexcept{
+        constexpr const_reference back()const noexcept(Checking::nothrow){
+            Checking::require(!empty(), "memory_view::back");
             return _data[size() - 1];
         }
 
@@ -209,56 +337,110 @@ namespace memory_view{
             return _data;
         }
 
-        constexpr void remove_prefix(size_type n)noexcept{
+        // conversions:
+        // std::span converts implicitly through its range constructor
+        template<typename CharT = std::remove_const_t<T>,
+                 typename = std::enable_if_t<impl::is_char_v<CharT>>>
+        constexpr operator std::basic_string_view<CharT>()const noexcept{
+            return std::basic_string_view<CharT>(_data, _size);
+        }
+
+        constexpr void remove_prefix(size_type n)noexcept(Checking::nothrow){
+            Checking::require(n <= size(), "memory_view::remove_prefix");
             _data += n;
             _size -= n;
         }
-        constexpr void remove_suffix(size_type n)noexcept{
+        constexpr void remove_suffix(size_type n)noexcept(Checking::nothrow){
+            Checking::require(n <= size(), "memory_view::remove_suffix");
             _size -= n;
         }
 
         constexpr memory_view view(size_type pos = 0, size_type count = npos)const{
-            if(pos >= size())
+            if(pos > size())
                 impl::throw_out_of_range("memory_view::view");
-            return memory_view(data() + pos, std::min(count, size() - pos));
+            return memory_view(_data + pos, std::min(count, size() - pos));
+        }
+
+        // non throwing slicing:
+        constexpr std::optional<memory_view> try_view(size_type pos = 0, size_type count = npos)const noexcept{
+            if(pos > size())
+                return std::nullopt;
+            return memory_view(_data + pos, std::min(count, size() - pos));
+        }
+        constexpr memory_view subview_clamped(size_type pos = 0, size_type count = npos)const noexcept{
+            pos = std::min(pos, size());
+            return memory_view(_data + pos, std::min(count, size() - pos));
+        }
+        constexpr memory_view first(size_type n)const noexcept{
+            return memory_view(_data, std::min(n, size()));
+        }
+        constexpr memory_view last(size_type n)const noexcept{
+            n = std::min(n, size());
+            return memory_view(_data + (size() - n), n);
+        }
+        constexpr std::pair<memory_view, memory_view> split_at(size_type n)const noexcept{
+            n = std::min(n, size());
+            return {memory_view(_data, n), memory_view(_data + n, size() - n)};
         }
     };
 
-    template<class T>
-    constexpr bool operator==(const memory_view<T>& lhs, const memory_view<T>& rhs)noexcept{
+    template<typename T>
+    memory_view(T*, std::size_t) -> memory_view<T>;
+    template<typename T>
+    memory_view(T*, T*) -> memory_view<T>;
+    template<typename R>
+    memory_view(R&&) -> memory_view<std::remove_pointer_t<decltype(std::data(std::declval<R&>()))>>;
+
+    template<typename T>
+    using unchecked_view = memory_view<T, checking::unchecked>;
+    template<typename T>
+    using hardened_view  = memory_view<T, checking::hardened>;
+    template<typename T>
+    using checked_view   = memory_view<T, checking::checked>;
+
+    // views with different checking policies compare equal if their elements do
+    template<class T, class C1, class C2>
+    constexpr bool operator==(const memory_view<T, C1>& lhs, const memory_view<T, C2>& rhs)noexcept{
         if(!(lhs.size() == rhs.size()))
             return false;
         for(std::size_t i = 0; i < lhs.size(); i++)
-            if(!(lhs[i] == rhs[i]))
+            if(!(lhs.data()[i] == rhs.data()[i]))
                 return false;
         return true;
     }
-    template<class T>
-    constexpr bool operator!=(const memory_view<T>& lhs, const memory_view<T>& rhs)noexcept{
+    template<class T, class C1, class C2>
+    constexpr bool operator!=(const memory_view<T, C1>& lhs, const memory_view<T, C2>& rhs)noexcept{
         return !(lhs == rhs);
     }
 
-    template<class T>
-    constexpr bool operator< (const memory_view<T>& lhs, const memory_view<T>& rhs)noexcept{
-        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin, rhs.end());
+    template<class T, class C1, class C2>
+    constexpr bool operator< (const memory_view<T, C1>& lhs, const memory_view<T, C2>& rhs)noexcept{
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
-    template<class T>
-    constexpr bool operator> (const memory_view<T>& lhs, const memory_view<T>& rhs)noexcept{
+    template<class T, class C1, class C2>
+    constexpr bool operator> (const memory_view<T, C1>& lhs, const memory_view<T, C2>& rhs)noexcept{
         return rhs < lhs;
     }
-    template<class T>
-    constexpr bool operator<=(const memory_view<T>& lhs, const memory_view<T>& rhs)noexcept{
+    template<class T, class C1, class C2>
+    constexpr bool operator<=(const memory_view<T, C1>& lhs, const memory_view<T, C2>& rhs)noexcept{
         return !(rhs < lhs);
     }
-    template<class T>
-    constexpr bool operator>=(const memory_view<T>& lhs, const memory_view<T>& rhs)noexcept{
+    template<class T, class C1, class C2>
+    constexpr bool operator>=(const memory_view<T, C1>& lhs, const memory_view<T, C2>& rhs)noexcept{
         return !(lhs < rhs);
     }
 
-    template<class T>
-    void swap(memory_view<T>& x, memory_view<T>& y)noexcept(noexcept(x.swap(y))){
+    template<class T, class C>
+    void swap(memory_view<T, C>& x, memory_view<T, C>& y)noexcept(noexcept(x.swap(y))){
         x.swap(y);
     }
 }
 
+#if defined(__cpp_lib_ranges)
+template<typename T, typename C>
+inline constexpr bool std::ranges::enable_borrowed_range<memory_view::memory_view<T, C>> = true;
+template<typename T, typename C>
+inline constexpr bool std::ranges::enable_view<memory_view::memory_view<T, C>> = true;
+#endif /* defined(__cpp_lib_ranges) */
+
 #endif /* MEMORY_VIEW_HPP */
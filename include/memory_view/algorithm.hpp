@@ -0,0 +1,281 @@
+/**
+ * @file   memory_view/include/memory_view/algorithm.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  overlap aware moves, rotations and shifts within views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_ALGORITHM_HPP
+#define MEMORY_VIEW_ALGORITHM_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__AVX__) */
+
+namespace memory_view{
+    namespace impl{
+        template<typename T>
+        void swap_blocks(T* a, T* b, std::size_t n){
+            if constexpr(std::is_trivially_copyable_v<T>){
+                // swap through a small buffer, memcpy copies whole vectors at a time
+                constexpr std::size_t chunk = 256 / sizeof(T) ? 256 / sizeof(T) : 1;
+                alignas(T) unsigned char buffer[chunk * sizeof(T)];
+                for(std::size_t i = 0; i < n; i += chunk){
+                    const std::size_t bytes = std::min(chunk, n - i) * sizeof(T);
+                    std::memcpy(buffer, a + i, bytes);
+                    std::memcpy(a + i, b + i, bytes);
+                    std::memcpy(b + i, buffer, bytes);
+                }
+            }else{
+                std::swap_ranges(a, a + n, b);
+            }
+        }
+
+        // bytes replicated with doubling memcpy before whole blocks are copied,
+        // the block stays in L1 while it is copied over the view
+        inline constexpr std::size_t fill_block = 4096;
+
+        // fill bytes [0, n) of dst with the pattern in [0, filled), filled > 0
+        inline void replicate(unsigned char* dst, std::size_t filled, std::size_t n)noexcept{
+            // only replicate whole patterns, so the block is a multiple of the pattern
+            const std::size_t pattern = filled;
+            while(filled < n && filled < fill_block){
+                const std::size_t bytes = std::min(filled, n - filled);
+                std::memcpy(dst + filled, dst, bytes);
+                filled += bytes;
+            }
+            const std::size_t block = filled - filled % pattern;
+            for(; filled < n; filled += block)
+                std::memcpy(dst + filled, dst, std::min(block, n - filled));
+        }
+    }
+
+    // true if a and b share at least one element
+    template<typename T, typename C1, typename U, typename C2>
+    bool overlaps(memory_view<T, C1> a, memory_view<U, C2> b)noexcept{
+        if(a.empty() || b.empty())
+            return false;
+        const std::less<const void*> less;
+        return less(static_cast<const void*>(a.data()), static_cast<const void*>(b.data() + b.size())) &&
+               less(static_cast<const void*>(b.data()), static_cast<const void*>(a.data() + a.size()));
+    }
+
+    /**
+     * Move the elements of src into dst (src.size() == dst.size()), the views may overlap.
+     *
+     * Trivially copyable types are moved with memmove, other types element
+     * wise in the direction which does not overwrite elements before they are moved.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    void move_overlapping(memory_view<T, C1> src, memory_view<U, C2> dst){
+        if(src.size() != dst.size())
+            impl::throw_out_of_range("memory_view::move_overlapping");
+        if(src.empty() || static_cast<const void*>(src.data()) == static_cast<const void*>(dst.data()))
+            return;
+
+        if constexpr(std::is_same_v<std::remove_const_t<T>, U> && std::is_trivially_copyable_v<U>){
+            std::memmove(dst.data(), src.data(), src.size() * sizeof(U));
+        }else{
+            if(std::less<const void*>{}(static_cast<const void*>(dst.data()), static_cast<const void*>(src.data())))
+                std::move(src.begin(), src.end(), dst.begin());
+            else
+                std::move_backward(src.begin(), src.end(), dst.end());
+        }
+    }
+
+    // move count elements from src_pos to dst_pos within view
+    template<typename T, typename C>
+    void copy_within(memory_view<T, C> view, std::size_t src_pos, std::size_t count, std::size_t dst_pos){
+        if(src_pos > view.size() || count > view.size() - src_pos ||
+           dst_pos > view.size() || count > view.size() - dst_pos)
+            impl::throw_out_of_range("memory_view::copy_within");
+        move_overlapping(view.view(src_pos, count), view.view(dst_pos, count));
+    }
+
+    /**
+     * Rotate view left so that the element at middle becomes the first one.
+     *
+     * Uses the block swap algorithm: the shorter side is swapped into its
+     * final place and the remainder is rotated, every element is moved once per swap.
+     */
+    template<typename T, typename C>
+    void rotate(memory_view<T, C> view, std::size_t middle){
+        if(middle > view.size())
+            impl::throw_out_of_range("memory_view::rotate");
+        T* p = view.data();
+        std::size_t left  = middle;
+        std::size_t right = view.size() - middle;
+        if(left == 0 || right == 0)
+            return;
+
+        while(left != right){
+            if(left < right){
+                // A B1 B2 -> B2 B1 A, A is in place, rotate B2 B1
+                impl::swap_blocks(p, p + right, left);
+                right -= left;
+            }else{
+                // A1 A2 B -> B A2 A1, B is in place, rotate A2 A1
+                impl::swap_blocks(p, p + left, right);
+                p    += right;
+                left -= right;
+            }
+        }
+        impl::swap_blocks(p, p + left, left);
+    }
+
+    /**
+     * Shift the elements of view n positions towards the front,
+     * returns the view of the shifted elements, the remaining elements are moved from.
+     */
+    template<typename T, typename C>
+    memory_view<T, C> shift_left(memory_view<T, C> view, std::size_t n){
+        if(n >= view.size())
+            return view.first(0);
+        const std::size_t count = view.size() - n;
+        move_overlapping(view.last(count), view.first(count));
+        return view.first(count);
+    }
+
+    /**
+     * Shift the elements of view n positions towards the back,
+     * returns the view of the shifted elements, the leading elements are moved from.
+     */
+    template<typename T, typename C>
+    memory_view<T, C> shift_right(memory_view<T, C> view, std::size_t n){
+        if(n >= view.size())
+            return view.last(0);
+        const std::size_t count = view.size() - n;
+        move_overlapping(view.first(count), view.last(count));
+        return view.last(count);
+    }
+
+    /**
+     * Assign value to every element of view.
+     *
+     * Byte types are filled with memset, other trivially copyable types
+     * by replicating the value with memcpy which uses the widest stores available.
+     */
+    template<typename T, typename C>
+    void fill(memory_view<T, C> view, const T& value){
+        if(view.empty())
+            return;
+        if constexpr(sizeof(T) == 1 && std::is_trivially_copyable_v<T>){
+            unsigned char byte;
+            std::memcpy(&byte, &value, 1);
+            std::memset(view.data(), byte, view.size());
+        }else if constexpr(std::is_trivially_copyable_v<T>){
+            view[0] = value;
+            impl::replicate(reinterpret_cast<unsigned char*>(view.data()), sizeof(T), view.size() * sizeof(T));
+        }else{
+            std::fill(view.begin(), view.end(), value);
+        }
+    }
+
+    /**
+     * Repeat pattern over view, view[i] = pattern[i % pattern.size()].
+     * pattern must not overlap view.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    void fill_pattern(memory_view<T, C1> view, memory_view<U, C2> pattern){
+        if(view.empty())
+            return;
+        if(pattern.empty())
+            impl::throw_out_of_range("memory_view::fill_pattern");
+
+        const std::size_t first = std::min(view.size(), pattern.size());
+        if constexpr(std::is_same_v<std::remove_const_t<U>, T> && std::is_trivially_copyable_v<T>){
+            std::memcpy(view.data(), pattern.data(), first * sizeof(T));
+            impl::replicate(reinterpret_cast<unsigned char*>(view.data()), first * sizeof(T), view.size() * sizeof(T));
+        }else{
+            for(std::size_t i = 0; i < view.size(); i += first)
+                std::copy_n(pattern.begin(), std::min(first, view.size() - i), view.begin() + i);
+        }
+    }
+
+    /**
+     * Like fill, but the bulk of the view is written with non-temporal stores
+     * which bypass the cache, for views much larger than the last level cache
+     * which are not read soon afterwards.
+     *
+     * Falls back to fill if the size of T does not divide the vector width.
+     */
+    template<typename T, typename C>
+    void fill_nontemporal(memory_view<T, C> view, const T& value){
+#if defined(__SSE2__) || defined(__AVX__)
+#if defined(__AVX__)
+        constexpr std::size_t width = 32;
+#else
+        constexpr std::size_t width = 16;
+#endif /* defined(__AVX__) */
+        if constexpr(std::is_trivially_copyable_v<T> && width % sizeof(T) == 0){
+            unsigned char* p = reinterpret_cast<unsigned char*>(view.data());
+            const std::size_t bytes = view.size() * sizeof(T);
+            std::size_t head = (width - reinterpret_cast<std::uintptr_t>(p) % width) % width;
+            if(head % sizeof(T) != 0 || bytes < head + 2 * width){
+                // misaligned T or too small to matter
+                fill(view, value);
+                return;
+            }
+
+            // head is a multiple of sizeof(T), so the vector holds whole values in order
+            alignas(32) unsigned char pattern[width];
+            for(std::size_t i = 0; i < width; i += sizeof(T))
+                std::memcpy(pattern + i, &value, sizeof(T));
+            fill(view.first(head / sizeof(T)), value);
+
+            std::size_t i = head;
+#if defined(__AVX__)
+            const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern));
+            for(; i + width <= bytes; i += width)
+                _mm256_stream_si256(reinterpret_cast<__m256i*>(p + i), v);
+#else
+            const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+            for(; i + width <= bytes; i += width)
+                _mm_stream_si128(reinterpret_cast<__m128i*>(p + i), v);
+#endif /* defined(__AVX__) */
+            // order the streaming stores before later stores of this thread
+            _mm_sfence();
+            fill(view.last((bytes - i) / sizeof(T)), value);
+            return;
+        }
+#endif /* defined(__SSE2__) || defined(__AVX__) */
+        fill(view, value);
+    }
+}
+
+#endif /* MEMORY_VIEW_ALGORITHM_HPP */
@@ -0,0 +1,215 @@
+/**
+ * @file   memory_view/include/memory_view/byte_order.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  bulk byte swap, bit reversal and byte shuffles over views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_BYTE_ORDER_HPP
+#define MEMORY_VIEW_BYTE_ORDER_HPP
+
+#include "../memory_view.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif /* defined(__AVX2__) || defined(__AVX512BW__) */
+
+namespace memory_view{
+    namespace impl{
+        constexpr unsigned char reverse_bits(unsigned char b)noexcept{
+            b = static_cast<unsigned char>(((b & 0xF0u) >> 4) | ((b & 0x0Fu) << 4));
+            b = static_cast<unsigned char>(((b & 0xCCu) >> 2) | ((b & 0x33u) << 2));
+            b = static_cast<unsigned char>(((b & 0xAAu) >> 1) | ((b & 0x55u) << 1));
+            return b;
+        }
+
+        /**
+         * Apply pattern to every group of N bytes, dst[j] = src[pattern[j]],
+         * and reverse the bits of every byte if ReverseBits.
+         * bytes is a multiple of N and N divides 16, src may be equal to dst.
+         */
+        template<std::size_t N, bool ReverseBits>
+        void shuffle_groups(const unsigned char* src, unsigned char* dst, std::size_t bytes,
+                            const unsigned char* pattern)noexcept{
+            static_assert(16 % N == 0, "the group size must divide 16");
+            std::size_t i = 0;
+
+#if defined(__SSSE3__)
+            // N divides 16, so every 16 byte lane holds whole groups and one pshufb mask fits all,
+            // the tables are repeated for every lane of the widest vector
+            alignas(64) unsigned char mask[64];
+            alignas(64) unsigned char low_table[64];
+            alignas(64) unsigned char high_table[64];
+            for(std::size_t j = 0; j < 64; j++){
+                const std::size_t k = j % 16;
+                mask[j]       = static_cast<unsigned char>(k / N * N + pattern[k % N]);
+                // reversed nibble, for the low nibble shifted into the high one
+                high_table[j] = reverse_bits(static_cast<unsigned char>(k << 4));
+                low_table[j]  = static_cast<unsigned char>(high_table[j] << 4);
+            }
+            const __m128i m    = _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+            const __m128i low  = _mm_load_si128(reinterpret_cast<const __m128i*>(low_table));
+            const __m128i high = _mm_load_si128(reinterpret_cast<const __m128i*>(high_table));
+
+#if defined(__AVX512BW__)
+            const __m512i m512      = _mm512_load_si512(mask);
+            const __m512i low512    = _mm512_load_si512(low_table);
+            const __m512i high512   = _mm512_load_si512(high_table);
+            const __m512i nibble512 = _mm512_set1_epi8(0x0F);
+            for(; i + 64 <= bytes; i += 64){
+                __m512i v = _mm512_shuffle_epi8(_mm512_loadu_si512(src + i), m512);
+                if constexpr(ReverseBits)
+                    v = _mm512_or_si512(_mm512_shuffle_epi8(low512, _mm512_and_si512(v, nibble512)),
+                                        _mm512_shuffle_epi8(high512, _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble512)));
+                _mm512_storeu_si512(dst + i, v);
+            }
+#endif /* defined(__AVX512BW__) */
+#if defined(__AVX2__)
+            const __m256i m256      = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+            const __m256i low256    = _mm256_load_si256(reinterpret_cast<const __m256i*>(low_table));
+            const __m256i high256   = _mm256_load_si256(reinterpret_cast<const __m256i*>(high_table));
+            const __m256i nibble256 = _mm256_set1_epi8(0x0F);
+            for(; i + 32 <= bytes; i += 32){
+                __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), m256);
+                if constexpr(ReverseBits)
+                    v = _mm256_or_si256(_mm256_shuffle_epi8(low256, _mm256_and_si256(v, nibble256)),
+                                        _mm256_shuffle_epi8(high256, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble256)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+            }
+#endif /* defined(__AVX2__) */
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            for(; i + 16 <= bytes; i += 16){
+                __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), m);
+                if constexpr(ReverseBits)
+                    v = _mm_or_si128(_mm_shuffle_epi8(low, _mm_and_si128(v, nibble)),
+                                     _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(v, 4), nibble)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+            }
+#endif /* defined(__SSSE3__) */
+
+            for(; i < bytes; i += N){
+                unsigned char group[N];
+                std::memcpy(group, src + i, N);
+                for(std::size_t j = 0; j < N; j++)
+                    dst[i + j] = ReverseBits ? reverse_bits(group[pattern[j]]) : group[pattern[j]];
+            }
+        }
+
+        template<std::size_t N, std::size_t... I>
+        constexpr auto reversed_pattern(std::index_sequence<I...>)noexcept{
+            return std::array<unsigned char, N>{static_cast<unsigned char>(N - 1 - I)...};
+        }
+
+        template<std::size_t N, bool ReverseBits>
+        void reverse_groups(const unsigned char* src, unsigned char* dst, std::size_t bytes)noexcept{
+            static constexpr auto pattern = reversed_pattern<N>(std::make_index_sequence<N>{});
+            shuffle_groups<N, ReverseBits>(src, dst, bytes, pattern.data());
+        }
+
+        template<typename T, typename C1, typename U, typename C2>
+        void check_byte_views(memory_view<T, C1> src, memory_view<U, C2> dst, const char* s){
+            static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_copyable_v<U>,
+                          "byte order functions require trivially copyable types");
+            static_assert(sizeof(T) == sizeof(U), "source and destination element sizes differ");
+            static_assert(!std::is_const_v<U>, "the destination must be mutable");
+            if(src.size() != dst.size())
+                throw_out_of_range(s);
+        }
+    }
+
+    /**
+     * Reverse the byte order of every element of src and store it in dst,
+     * src and dst are either equal or do not overlap.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    void byteswap(memory_view<T, C1> src, memory_view<U, C2> dst){
+        impl::check_byte_views(src, dst, "memory_view::byteswap");
+        static_assert(16 % sizeof(T) == 0, "byteswap supports 1, 2, 4, 8 and 16 byte elements");
+        impl::reverse_groups<sizeof(T), false>(reinterpret_cast<const unsigned char*>(src.data()),
+                                               reinterpret_cast<unsigned char*>(dst.data()), src.size() * sizeof(T));
+    }
+
+    template<typename T, typename C>
+    void byteswap(memory_view<T, C> view){
+        byteswap(view, view);
+    }
+
+    /**
+     * Reverse the bit order of every element of src (bit 0 becomes the
+     * most significant bit) and store it in dst, src and dst are either equal or do not overlap.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    void bit_reverse(memory_view<T, C1> src, memory_view<U, C2> dst){
+        impl::check_byte_views(src, dst, "memory_view::bit_reverse");
+        static_assert(16 % sizeof(T) == 0, "bit_reverse supports 1, 2, 4, 8 and 16 byte elements");
+        impl::reverse_groups<sizeof(T), true>(reinterpret_cast<const unsigned char*>(src.data()),
+                                              reinterpret_cast<unsigned char*>(dst.data()), src.size() * sizeof(T));
+    }
+
+    template<typename T, typename C>
+    void bit_reverse(memory_view<T, C> view){
+        bit_reverse(view, view);
+    }
+
+    /**
+     * Shuffle every group of sizeof...(I) bytes by the compile time pattern I,
+     * byte j of a group in dst is byte I[j] of the group in src.
+     *
+     * The group size must divide 16 and the size of the views in bytes
+     * must be a multiple of the group size.
+     * e.g. shuffle_bytes<2, 1, 0>(rgb, bgr) on 3 byte pixels is not possible,
+     * but shuffle_bytes<2, 1, 0, 3>(rgba, bgra) is.
+     */
+    template<std::size_t... I, typename T, typename C1, typename U, typename C2>
+    void shuffle_bytes(memory_view<T, C1> src, memory_view<U, C2> dst){
+        constexpr std::size_t n = sizeof...(I);
+        static_assert(n > 0 && 16 % n == 0, "the pattern size must divide 16");
+        static_assert(((I < n) && ...), "pattern index out of range");
+        impl::check_byte_views(src, dst, "memory_view::shuffle_bytes");
+        const std::size_t bytes = src.size() * sizeof(T);
+        if(bytes % n != 0)
+            impl::throw_out_of_range("memory_view::shuffle_bytes");
+        static constexpr unsigned char pattern[n] = {static_cast<unsigned char>(I)...};
+        impl::shuffle_groups<n, false>(reinterpret_cast<const unsigned char*>(src.data()),
+                                       reinterpret_cast<unsigned char*>(dst.data()), bytes, pattern);
+    }
+
+    template<std::size_t... I, typename T, typename C>
+    void shuffle_bytes(memory_view<T, C> view){
+        shuffle_bytes<I...>(view, view);
+    }
+}
+
+#endif /* MEMORY_VIEW_BYTE_ORDER_HPP */
@@ -0,0 +1,208 @@
+/**
+ * @file   memory_view/include/memory_view/convolution.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  FIR filters and convolution over float views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_CONVOLUTION_HPP
+#define MEMORY_VIEW_CONVOLUTION_HPP
+
+#include "../memory_view.hpp"
+#include "fft.hpp"
+#include "matrix_view.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) && defined(__FMA__) */
+
+namespace memory_view{
+    namespace impl{
+        // taps from which on convolve_valid switches from the direct form to overlap-save
+        inline constexpr std::size_t fft_convolution_taps = 64;
+
+        // y[i] += a * x[i]
+        inline void axpy(float a, const float* x, float* y, std::size_t n)noexcept{
+            std::size_t i = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+            const __m256 va = _mm256_set1_ps(a);
+            for(; i + 8 <= n; i += 8)
+                _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+#endif /* defined(__AVX2__) && defined(__FMA__) */
+            for(; i < n; i++)
+                y[i] += a * x[i];
+        }
+
+        // direct form, processed in blocks of outputs which stay in L1
+        inline void convolve_direct(const float* x, const float* h, std::size_t taps, float* y, std::size_t n)noexcept{
+            constexpr std::size_t block = 1024;
+            for(std::size_t begin = 0; begin < n; begin += block){
+                const std::size_t count = std::min(block, n - begin);
+                std::fill(y + begin, y + begin + count, 0.0f);
+                for(std::size_t k = 0; k < taps; k++)
+                    axpy(h[taps - 1 - k], x + begin + k, y + begin, count);
+            }
+        }
+
+        // overlap-save with blocks of fft_size - taps + 1 outputs
+        inline void convolve_overlap_save(const float* x, std::size_t x_size, const float* h, std::size_t taps,
+                                          float* y, std::size_t n){
+            std::size_t fft_size = 1;
+            while(fft_size < 4 * taps)
+                fft_size <<= 1;
+            const std::size_t step = fft_size - taps + 1;
+            const float scale = 1.0f / static_cast<float>(fft_size);
+
+            rfft_plan plan(fft_size);
+            std::vector<float> segment(fft_size);
+            std::vector<std::complex<float>> hf(fft_size / 2 + 1);
+            std::vector<std::complex<float>> xf(fft_size / 2 + 1);
+
+            for(std::size_t k = 0; k < taps; k++)
+                segment[k] = h[k] * scale;
+            plan.forward(memory_view<const float>(segment), memory_view<std::complex<float>>(hf));
+
+            for(std::size_t begin = 0; begin < n; begin += step){
+                const std::size_t avail = std::min(fft_size, x_size - begin);
+                std::copy(x + begin, x + begin + avail, segment.begin());
+                std::fill(segment.begin() + static_cast<std::ptrdiff_t>(avail), segment.end(), 0.0f);
+                plan.forward(memory_view<const float>(segment), memory_view<std::complex<float>>(xf));
+                for(std::size_t i = 0; i < xf.size(); i++)
+                    xf[i] = cmul(xf[i], hf[i]);
+                plan.inverse(memory_view<const std::complex<float>>(xf), memory_view<float>(segment));
+                const std::size_t count = std::min(step, n - begin);
+                std::copy(segment.begin() + static_cast<std::ptrdiff_t>(taps - 1),
+                          segment.begin() + static_cast<std::ptrdiff_t>(taps - 1 + count),
+                          y + begin);
+            }
+        }
+    }
+
+    /**
+     * Valid part of the convolution of x with h:
+     *   y[i] = sum(h[k] * x[i + h.size() - 1 - k]), y.size() == x.size() - h.size() + 1
+     *
+     * Short filters use the direct form, long filters overlap-save with FFTs.
+     */
+    inline void convolve_valid(memory_view<const float> x, memory_view<const float> h, memory_view<float> y){
+        if(h.empty() || x.size() < h.size() || y.size() != x.size() - h.size() + 1)
+            impl::throw_out_of_range("memory_view::convolve_valid");
+
+        if(h.size() < impl::fft_convolution_taps)
+            impl::convolve_direct(x.data(), h.data(), h.size(), y.data(), y.size());
+        else
+            impl::convolve_overlap_save(x.data(), x.size(), h.data(), h.size(), y.data(), y.size());
+    }
+
+    /**
+     * Streaming FIR filter, keeps the last taps - 1 input samples
+     * so successive views are filtered as one continuous signal.
+     */
+    class fir_filter{
+        std::vector<float> _taps;
+        std::vector<float> _buffer; // history followed by the current input
+
+    public:
+        explicit fir_filter(memory_view<const float> taps):
+            _taps(taps.begin(), taps.end()),
+            _buffer(taps.empty() ? 0 : taps.size() - 1, 0.0f){
+            if(taps.empty())
+                impl::throw_out_of_range("memory_view::fir_filter");
+        }
+
+        std::size_t taps()const noexcept{
+            return _taps.size();
+        }
+
+        // forget the history, as if the filter was just constructed
+        void reset()noexcept{
+            _buffer.assign(_taps.size() - 1, 0.0f);
+        }
+
+        // filter in into out, out.size() == in.size(), in and out may be the same view
+        void process(memory_view<const float> in, memory_view<float> out){
+            if(in.size() != out.size())
+                impl::throw_out_of_range("memory_view::fir_filter::process");
+
+            const std::size_t history = _taps.size() - 1;
+            _buffer.resize(history);
+            _buffer.insert(_buffer.end(), in.begin(), in.end());
+            convolve_valid(memory_view<const float>(_buffer), memory_view<const float>(_taps), out);
+            _buffer.erase(_buffer.begin(), _buffer.end() - static_cast<std::ptrdiff_t>(history));
+        }
+    };
+
+    /**
+     * 2-D separable convolution with kx along the rows and ky along the columns,
+     * dst has the shape of src, the borders are extended by clamping.
+     * Both kernels are centered at size / 2, src and dst must not overlap.
+     */
+    inline void separable_convolve(matrix_view<const float> src, memory_view<const float> kx,
+                                   memory_view<const float> ky, matrix_view<float> dst){
+        if(src.rows() != dst.rows() || src.cols() != dst.cols() || kx.empty() || ky.empty())
+            impl::throw_out_of_range("memory_view::separable_convolve");
+        if(src.empty())
+            return;
+
+        const std::size_t rows = src.rows();
+        const std::size_t cols = src.cols();
+        const std::size_t cx = kx.size() / 2;
+        const std::size_t cy = ky.size() / 2;
+
+        // horizontal pass over clamped rows, convolve_valid reads padded[c + kx.size() - 1 - k],
+        // so the left border is kx.size() - 1 - cx wide for out[c] = sum(kx[k] * row[c + cx - k])
+        // like the vertical pass, also for even kernel sizes
+        const std::size_t left = kx.size() - 1 - cx;
+        std::vector<float> tmp(rows * cols);
+        std::vector<float> padded(cols + kx.size() - 1);
+        for(std::size_t r = 0; r < rows; r++){
+            const float* row = src.row(r).data();
+            for(std::size_t j = 0; j < padded.size(); j++){
+                const std::size_t c = j < left ? 0 : std::min(j - left, cols - 1);
+                padded[j] = row[c];
+            }
+            convolve_valid(memory_view<const float>(padded), kx, memory_view<float>(tmp.data() + r * cols, cols));
+        }
+
+        // vertical pass, accumulate whole rows so the inner loop is contiguous
+        for(std::size_t r = 0; r < rows; r++){
+            float* out = dst.row(r).data();
+            std::fill(out, out + cols, 0.0f);
+            for(std::size_t k = 0; k < ky.size(); k++){
+                const std::size_t shifted = r + cy;
+                const std::size_t s = shifted < k ? 0 : std::min(shifted - k, rows - 1);
+                impl::axpy(ky[k], tmp.data() + s * cols, out, cols);
+            }
+        }
+    }
+}
+
+#endif /* MEMORY_VIEW_CONVOLUTION_HPP */
@@ -0,0 +1,378 @@
+/**
+ * @file   memory_view/include/memory_view/encoding.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  run length and dictionary encoding of views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_ENCODING_HPP
+#define MEMORY_VIEW_ENCODING_HPP
+
+#include "../memory_view.hpp"
+#include "algorithm.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__AVX2__) */
+
+namespace memory_view{
+    namespace impl{
+        inline unsigned count_trailing_zeros(std::uint32_t x)noexcept{
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctz(x));
+#else
+            unsigned n = 0;
+            for(; !(x & 1u); x >>= 1)
+                n++;
+            return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+        }
+
+        /**
+         * Index one past the run starting at p[begin], the end of the run is found
+         * by comparing the bytes of p[i] and p[i + 1] a vector at a time.
+         */
+        template<typename T>
+        std::size_t run_end(const T* p, std::size_t begin, std::size_t n)noexcept{
+            std::size_t i = begin;
+            if constexpr(std::is_integral_v<T> || std::is_enum_v<T>){
+#if defined(__AVX2__) || defined(__SSE2__)
+                const unsigned char* b = reinterpret_cast<const unsigned char*>(p);
+                const std::size_t last = (n - 1) * sizeof(T); // bytes which have a successor
+                std::size_t k = i * sizeof(T);
+#if defined(__AVX2__)
+                for(; k + 32 <= last; k += 32){
+                    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k));
+                    const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k + sizeof(T)));
+                    const std::uint32_t equal = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+                    if(equal != 0xFFFFFFFFu)
+                        return (k + count_trailing_zeros(~equal)) / sizeof(T) + 1;
+                }
+#endif /* defined(__AVX2__) */
+                for(; k + 16 <= last; k += 16){
+                    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + k));
+                    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + k + sizeof(T)));
+                    const std::uint32_t equal = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+                    if(equal != 0xFFFFu)
+                        return (k + count_trailing_zeros(~equal)) / sizeof(T) + 1;
+                }
+                i = k / sizeof(T);
+#endif /* defined(__AVX2__) || defined(__SSE2__) */
+            }
+            while(i + 1 < n && p[i + 1] == p[i])
+                i++;
+            return i + 1;
+        }
+
+        template<typename W>
+        inline constexpr bool is_packed_word_v = std::is_same_v<std::remove_const_t<W>, std::uint64_t>;
+
+        inline std::uint64_t unpack_bits(const std::uint64_t* words, std::size_t index, unsigned bits)noexcept{
+            const std::size_t bit    = index * bits;
+            const std::size_t word   = bit / 64;
+            const std::size_t last   = (bit + bits - 1) / 64; // word of the last bit
+            const unsigned    offset = static_cast<unsigned>(bit % 64);
+            std::uint64_t v = words[word] >> offset;
+            if(last != word)
+                v |= words[last] << (64 - offset);
+            return bits == 64 ? v : v & ((std::uint64_t{1} << bits) - 1);
+        }
+
+        // maps values to dictionary codes, a flat table for small integral types except bool
+        template<typename T, bool Flat = (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 2)>
+        class code_map{
+            std::unordered_map<T, std::uint32_t> _codes;
+
+        public:
+            static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+
+            std::uint32_t find(const T& value)const{
+                const auto it = _codes.find(value);
+                return it == _codes.end() ? none : it->second;
+            }
+            void insert(const T& value, std::uint32_t code){
+                _codes.emplace(value, code);
+            }
+        };
+
+        template<typename T>
+        class code_map<T, true>{
+            std::vector<std::uint32_t> _codes;
+
+            static std::size_t key(T value)noexcept{
+                return static_cast<std::make_unsigned_t<T>>(value);
+            }
+
+        public:
+            static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+
+            code_map():
+                _codes(std::size_t{1} << (8 * sizeof(T)), none){}
+
+            std::uint32_t find(T value)const noexcept{
+                return _codes[key(value)];
+            }
+            void insert(T value, std::uint32_t code)noexcept{
+                _codes[key(value)] = code;
+            }
+        };
+    }
+
+    // run length encoding:
+
+    // number of runs of equal values in in
+    template<typename T, typename C>
+    std::size_t rle_runs(memory_view<T, C> in)noexcept{
+        std::size_t runs = 0;
+        for(std::size_t i = 0; i < in.size(); i = impl::run_end(in.data(), i, in.size()))
+            runs++;
+        return runs;
+    }
+
+    /**
+     * Encode in as runs of equal values, run i repeats values[i] lengths[i] times.
+     * Returns the number of runs, runs longer than the range of uint32_t are split.
+     * Integral and enum types are compared bitwise with SIMD, other types with operator==.
+     */
+    template<typename T, typename C1, typename C2, typename C3>
+    std::size_t rle_encode(memory_view<T, C1> in, memory_view<std::remove_const_t<T>, C2> values,
+                           memory_view<std::uint32_t, C3> lengths){
+        constexpr std::size_t max_length = std::numeric_limits<std::uint32_t>::max();
+        std::size_t runs = 0;
+        for(std::size_t i = 0; i < in.size();){
+            const std::size_t end = impl::run_end(in.data(), i, in.size());
+            for(; i < end; i += std::min(end - i, max_length)){
+                if(runs >= values.size() || runs >= lengths.size())
+                    impl::throw_out_of_range("memory_view::rle_encode");
+                values.data()[runs]  = in.data()[i];
+                lengths.data()[runs] = static_cast<std::uint32_t>(std::min(end - i, max_length));
+                runs++;
+            }
+        }
+        return runs;
+    }
+
+    /**
+     * Expand the runs into out, returns the number of elements written
+     * which is the sum of lengths.
+     */
+    template<typename T, typename C1, typename L, typename C2, typename U, typename C3>
+    std::size_t rle_decode(memory_view<T, C1> values, memory_view<L, C2> lengths, memory_view<U, C3> out){
+        if(values.size() != lengths.size())
+            impl::throw_out_of_range("memory_view::rle_decode");
+        std::size_t n = 0;
+        for(std::size_t r = 0; r < values.size(); r++){
+            const std::size_t length = lengths.data()[r];
+            if(length > out.size() - n)
+                impl::throw_out_of_range("memory_view::rle_decode");
+            if(length < 16){
+                for(std::size_t i = 0; i < length; i++)
+                    out.data()[n + i] = values.data()[r];
+            }else{
+                fill(out.view(n, length), static_cast<U>(values.data()[r]));
+            }
+            n += length;
+        }
+        return n;
+    }
+
+    // number of encoded elements for which pred is true, pred is evaluated once per run
+    template<typename T, typename C1, typename L, typename C2, typename P>
+    std::size_t rle_count_if(memory_view<T, C1> values, memory_view<L, C2> lengths, P pred){
+        if(values.size() != lengths.size())
+            impl::throw_out_of_range("memory_view::rle_count_if");
+        std::size_t count = 0;
+        for(std::size_t r = 0; r < values.size(); r++)
+            if(pred(values.data()[r]))
+                count += lengths.data()[r];
+        return count;
+    }
+
+    /**
+     * Write the positions of the encoded elements for which pred is true into out,
+     * returns the number of positions written, stops once out is full.
+     */
+    template<typename T, typename C1, typename L, typename C2, typename P, typename C3>
+    std::size_t rle_select_if(memory_view<T, C1> values, memory_view<L, C2> lengths, P pred,
+                              memory_view<std::size_t, C3> out){
+        if(values.size() != lengths.size())
+            impl::throw_out_of_range("memory_view::rle_select_if");
+        std::size_t count = 0;
+        std::size_t position = 0;
+        for(std::size_t r = 0; r < values.size() && count < out.size(); r++){
+            const std::size_t length = lengths.data()[r];
+            if(pred(values.data()[r]))
+                for(std::size_t i = 0; i < length && count < out.size(); i++)
+                    out.data()[count++] = position + i;
+            position += length;
+        }
+        return count;
+    }
+
+    // dictionary encoding:
+
+    struct dictionary_encoding{
+        std::size_t dictionary_size; // number of distinct values
+        unsigned    bits;            // bits per packed index
+    };
+
+    // bits per index for a dictionary of size values
+    constexpr unsigned dictionary_bits(std::size_t size)noexcept{
+        unsigned bits = 1;
+        while(bits < 64 && (std::uint64_t{1} << bits) < size)
+            bits++;
+        return bits;
+    }
+
+    // number of 64 bit words for n indices of bits each
+    constexpr std::size_t packed_words(std::size_t n, unsigned bits)noexcept{
+        return (n * bits + 63) / 64;
+    }
+
+    /**
+     * Replace every value of in by its index in dictionary, the indices are
+     * bit packed into packed starting at the least significant bit of packed[0].
+     *
+     * The dictionary holds the distinct values in order of first appearance,
+     * packed needs packed_words(in.size(), dictionary_bits(dictionary.size())) words at most.
+     * Small integral types are looked up in a flat table, other types in a hash map.
+     */
+    template<typename T, typename C1, typename C2, typename C3>
+    dictionary_encoding dictionary_encode(memory_view<T, C1> in, memory_view<std::remove_const_t<T>, C2> dictionary,
+                                          memory_view<std::uint64_t, C3> packed){
+        impl::code_map<std::remove_const_t<T>> map;
+        std::vector<std::uint32_t> codes(in.size());
+        std::size_t size = 0;
+        for(std::size_t i = 0; i < in.size(); i++){
+            std::uint32_t code = map.find(in.data()[i]);
+            if(code == map.none){
+                if(size >= dictionary.size())
+                    impl::throw_out_of_range("memory_view::dictionary_encode");
+                code = static_cast<std::uint32_t>(size);
+                dictionary.data()[size++] = in.data()[i];
+                map.insert(in.data()[i], code);
+            }
+            codes[i] = code;
+        }
+
+        const unsigned bits = dictionary_bits(size);
+        const std::size_t words = packed_words(in.size(), bits);
+        if(words > packed.size())
+            impl::throw_out_of_range("memory_view::dictionary_encode");
+
+        std::uint64_t* dst = packed.data();
+        std::fill(dst, dst + words, std::uint64_t{0});
+        for(std::size_t i = 0; i < codes.size(); i++){
+            const std::size_t bit    = i * bits;
+            const unsigned    offset = static_cast<unsigned>(bit % 64);
+            dst[bit / 64] |= std::uint64_t{codes[i]} << offset;
+            if(offset + bits > 64)
+                dst[bit / 64 + 1] |= std::uint64_t{codes[i]} >> (64 - offset);
+        }
+        return {size, bits};
+    }
+
+    // expand the packed indices into out (out.size() values), throws on an index outside of dictionary
+    template<typename T, typename C1, typename W, typename C2, typename U, typename C3>
+    void dictionary_decode(memory_view<T, C1> dictionary, memory_view<W, C2> packed, unsigned bits,
+                           memory_view<U, C3> out){
+        static_assert(impl::is_packed_word_v<W>, "the packed indices are stored in uint64_t words");
+        if(bits == 0 || bits > 64 || packed_words(out.size(), bits) > packed.size())
+            impl::throw_out_of_range("memory_view::dictionary_decode");
+        for(std::size_t i = 0; i < out.size(); i++){
+            const std::uint64_t code = impl::unpack_bits(packed.data(), i, bits);
+            if(code >= dictionary.size())
+                impl::throw_out_of_range("memory_view::dictionary_decode");
+            out.data()[i] = dictionary.data()[code];
+        }
+    }
+
+    namespace impl{
+        /**
+         * Evaluate pred once per dictionary entry, f(position) is called for every n encoded match.
+         * Like dictionary_decode this throws on an index outside of dictionary.
+         */
+        template<typename T, typename C1, typename W, typename C2, typename P, typename F>
+        void dictionary_scan(memory_view<T, C1> dictionary, memory_view<W, C2> packed, unsigned bits,
+                             std::size_t n, P& pred, F f){
+            static_assert(is_packed_word_v<W>, "the packed indices are stored in uint64_t words");
+            if(bits == 0 || bits > 64 || packed_words(n, bits) > packed.size())
+                throw_out_of_range("memory_view::dictionary_scan");
+            std::vector<unsigned char> match(dictionary.size());
+            for(std::size_t i = 0; i < dictionary.size(); i++)
+                match[i] = pred(dictionary.data()[i]) ? 1 : 0;
+            for(std::size_t i = 0; i < n; i++){
+                const std::uint64_t code = unpack_bits(packed.data(), i, bits);
+                if(code >= match.size())
+                    throw_out_of_range("memory_view::dictionary_scan");
+                if(match[code] && !f(i))
+                    return;
+            }
+        }
+    }
+
+    // number of the n encoded values for which pred is true, pred is evaluated once per dictionary entry
+    template<typename T, typename C1, typename W, typename C2, typename P>
+    std::size_t dictionary_count_if(memory_view<T, C1> dictionary, memory_view<W, C2> packed,
+                                    unsigned bits, std::size_t n, P pred){
+        std::size_t count = 0;
+        impl::dictionary_scan(dictionary, packed, bits, n, pred, [&](std::size_t){
+            count++;
+            return true;
+        });
+        return count;
+    }
+
+    /**
+     * Write the positions of the n encoded values for which pred is true into out,
+     * returns the number of positions written, stops once out is full.
+     */
+    template<typename T, typename C1, typename W, typename C2, typename P, typename C3>
+    std::size_t dictionary_select_if(memory_view<T, C1> dictionary, memory_view<W, C2> packed,
+                                     unsigned bits, std::size_t n, P pred, memory_view<std::size_t, C3> out){
+        std::size_t count = 0;
+        if(out.empty())
+            return 0;
+        impl::dictionary_scan(dictionary, packed, bits, n, pred, [&](std::size_t i){
+            out.data()[count++] = i;
+            return count < out.size();
+        });
+        return count;
+    }
+}
+
+#endif /* MEMORY_VIEW_ENCODING_HPP */
@@ -0,0 +1,317 @@
+/**
+ * @file   memory_view/include/memory_view/fft.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  planned FFTs over complex and real float views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_FFT_HPP
+#define MEMORY_VIEW_FFT_HPP
+
+#include "../memory_view.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX__) && defined(__FMA__)
+#include <immintrin.h>
+#endif /* defined(__AVX__) && defined(__FMA__) */
+
+namespace memory_view{
+    namespace impl{
+        using complex = std::complex<float>;
+
+        // plain complex multiplication, std::complex checks for NaN and infinities
+        inline complex cmul(complex a, complex b)noexcept{
+            return complex(a.real() * b.real() - a.imag() * b.imag(),
+                           a.real() * b.imag() + a.imag() * b.real());
+        }
+
+        inline complex twiddle(std::size_t k, std::size_t n, bool inverse)noexcept{
+            const double angle = (inverse ? 2.0 : -2.0) * 3.14159265358979323846
+                * static_cast<double>(k) / static_cast<double>(n);
+            return complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+        }
+
+#if defined(__AVX__) && defined(__FMA__)
+        // 4 interleaved complex multiplications
+        inline __m256 cmul(__m256 a, __m256 b)noexcept{
+            const __m256 b_re = _mm256_moveldup_ps(b);
+            const __m256 b_im = _mm256_movehdup_ps(b);
+            const __m256 a_swapped = _mm256_permute_ps(a, 0xb1);
+            return _mm256_fmaddsub_ps(a, b_re, _mm256_mul_ps(a_swapped, b_im));
+        }
+
+        // multiply by -i (forward) or i (inverse)
+        inline __m256 rotate_quarter(__m256 a, bool inverse)noexcept{
+            const __m256 swapped = _mm256_permute_ps(a, 0xb1); // (im, re)
+            const __m256 sign = inverse ? _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f)
+                                        : _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+            return _mm256_xor_ps(swapped, sign);
+        }
+#endif /* defined(__AVX__) && defined(__FMA__) */
+
+        inline complex rotate_quarter(complex a, bool inverse)noexcept{
+            return inverse ? complex(-a.imag(), a.real()) : complex(a.imag(), -a.real());
+        }
+    }
+
+    /**
+     * Plan for complex FFTs of a power of two size.
+     *
+     * The bit reversal permutation and the twiddle factors of all stages are
+     * computed once, the transforms run radix-4 stages (with one radix-2 stage
+     * for odd powers of two). The inverse transform is not scaled,
+     * inverse(forward(x)) == size() * x.
+     */
+    class fft_plan{
+        std::size_t                       _size;
+        std::vector<std::uint32_t>        _reverse;
+        // per radix-4 stage with quarter length l: w(k, 2l) for k < l followed by w(k, 4l)
+        std::vector<std::complex<float>>  _forward;
+        std::vector<std::complex<float>>  _inverse;
+
+        void stages(std::complex<float>* x, bool inverse)const noexcept{
+            using impl::complex;
+            const std::size_t n = _size;
+            const std::vector<complex>& twiddles = inverse ? _inverse : _forward;
+
+            std::size_t l = 1;
+            if((log2_size(n) & 1) != 0){
+                for(std::size_t i = 0; i < n; i += 2){
+                    const complex a = x[i];
+                    const complex b = x[i + 1];
+                    x[i]     = a + b;
+                    x[i + 1] = a - b;
+                }
+                l = 2;
+            }
+
+            const complex* w = twiddles.data();
+            for(; 4 * l <= n; l *= 4){
+                const complex* w1 = w;
+                const complex* w2 = w + l;
+                for(std::size_t g = 0; g < n; g += 4 * l){
+                    complex* x0 = x + g;
+                    complex* x1 = x0 + l;
+                    complex* x2 = x1 + l;
+                    complex* x3 = x2 + l;
+                    std::size_t k = 0;
+#if defined(__AVX__) && defined(__FMA__)
+                    for(; k + 4 <= l; k += 4){
+                        const __m256 a0 = _mm256_loadu_ps(reinterpret_cast<const float*>(x0 + k));
+                        const __m256 a1 = _mm256_loadu_ps(reinterpret_cast<const float*>(x1 + k));
+                        const __m256 a2 = _mm256_loadu_ps(reinterpret_cast<const float*>(x2 + k));
+                        const __m256 a3 = _mm256_loadu_ps(reinterpret_cast<const float*>(x3 + k));
+                        const __m256 v1 = _mm256_loadu_ps(reinterpret_cast<const float*>(w1 + k));
+                        const __m256 v2 = _mm256_loadu_ps(reinterpret_cast<const float*>(w2 + k));
+
+                        const __m256 t1 = impl::cmul(a1, v1);
+                        const __m256 t3 = impl::cmul(a3, v1);
+                        const __m256 b0 = _mm256_add_ps(a0, t1);
+                        const __m256 b1 = _mm256_sub_ps(a0, t1);
+                        const __m256 b2 = impl::cmul(_mm256_add_ps(a2, t3), v2);
+                        const __m256 b3 = impl::rotate_quarter(impl::cmul(_mm256_sub_ps(a2, t3), v2), inverse);
+
+                        _mm256_storeu_ps(reinterpret_cast<float*>(x0 + k), _mm256_add_ps(b0, b2));
+                        _mm256_storeu_ps(reinterpret_cast<float*>(x2 + k), _mm256_sub_ps(b0, b2));
+                        _mm256_storeu_ps(reinterpret_cast<float*>(x1 + k), _mm256_add_ps(b1, b3));
+                        _mm256_storeu_ps(reinterpret_cast<float*>(x3 + k), _mm256_sub_ps(b1, b3));
+                    }
+#endif /* defined(__AVX__) && defined(__FMA__) */
+                    for(; k < l; k++){
+                        const complex t1 = impl::cmul(x1[k], w1[k]);
+                        const complex t3 = impl::cmul(x3[k], w1[k]);
+                        const complex b0 = x0[k] + t1;
+                        const complex b1 = x0[k] - t1;
+                        const complex b2 = impl::cmul(x2[k] + t3, w2[k]);
+                        const complex b3 = impl::rotate_quarter(impl::cmul(x2[k] - t3, w2[k]), inverse);
+                        x0[k] = b0 + b2;
+                        x2[k] = b0 - b2;
+                        x1[k] = b1 + b3;
+                        x3[k] = b1 - b3;
+                    }
+                }
+                w += 2 * l;
+            }
+        }
+
+        static std::size_t log2_size(std::size_t n)noexcept{
+            std::size_t log = 0;
+            while((std::size_t{1} << log) < n)
+                log++;
+            return log;
+        }
+
+        void transform(memory_view<std::complex<float>> data, bool inverse)const{
+            if(data.size() != _size)
+                impl::throw_out_of_range("memory_view::fft_plan");
+            std::complex<float>* x = data.data();
+            for(std::size_t i = 0; i < _size; i++)
+                if(i < _reverse[i])
+                    std::swap(x[i], x[_reverse[i]]);
+            stages(x, inverse);
+        }
+
+        void transform(memory_view<const std::complex<float>> in, memory_view<std::complex<float>> out, bool inverse)const{
+            if(in.size() != _size || out.size() != _size)
+                impl::throw_out_of_range("memory_view::fft_plan");
+            for(std::size_t i = 0; i < _size; i++)
+                out[_reverse[i]] = in[i];
+            stages(out.data(), inverse);
+        }
+
+    public:
+        explicit fft_plan(std::size_t size):
+            _size{size},
+            _reverse(size){
+            if(size == 0 || (size & (size - 1)) != 0 || size > std::numeric_limits<std::uint32_t>::max())
+                impl::throw_out_of_range("memory_view::fft_plan");
+
+            const std::size_t log = log2_size(size);
+            for(std::size_t i = 0; i < size; i++){
+                std::size_t r = 0;
+                for(std::size_t b = 0; b < log; b++)
+                    if(i & (std::size_t{1} << b))
+                        r |= std::size_t{1} << (log - 1 - b);
+                _reverse[i] = static_cast<std::uint32_t>(r);
+            }
+
+            for(std::size_t l = (log & 1) ? 2 : 1; 4 * l <= size; l *= 4){
+                for(std::size_t k = 0; k < l; k++){
+                    _forward.push_back(impl::twiddle(k, 2 * l, false));
+                    _inverse.push_back(impl::twiddle(k, 2 * l, true));
+                }
+                for(std::size_t k = 0; k < l; k++){
+                    _forward.push_back(impl::twiddle(k, 4 * l, false));
+                    _inverse.push_back(impl::twiddle(k, 4 * l, true));
+                }
+            }
+        }
+
+        std::size_t size()const noexcept{
+            return _size;
+        }
+
+        // in place
+        void forward(memory_view<std::complex<float>> data)const{
+            transform(data, false);
+        }
+        void inverse(memory_view<std::complex<float>> data)const{
+            transform(data, true);
+        }
+
+        // out of place, in and out must not overlap
+        void forward(memory_view<const std::complex<float>> in, memory_view<std::complex<float>> out)const{
+            transform(in, out, false);
+        }
+        void inverse(memory_view<const std::complex<float>> in, memory_view<std::complex<float>> out)const{
+            transform(in, out, true);
+        }
+    };
+
+    /**
+     * Plan for FFTs of real input of a power of two size (at least 2).
+     *
+     * The real input is packed into a complex FFT of half the size,
+     * forward writes the size() / 2 + 1 non redundant bins.
+     * The inverse transform is not scaled, inverse(forward(x)) == size() * x.
+     * The plan holds a work buffer, use one plan per thread.
+     */
+    class rfft_plan{
+        std::size_t                      _size;
+        fft_plan                         _half;
+        std::vector<std::complex<float>> _twiddles; // w(k, size) for k <= size / 2
+        std::vector<std::complex<float>> _buffer;
+
+        // rejected before the half size plan is built, odd sizes have a power of two half
+        static std::size_t checked_size(std::size_t size){
+            if(size < 2 || (size & (size - 1)) != 0)
+                impl::throw_out_of_range("memory_view::rfft_plan");
+            return size;
+        }
+
+    public:
+        explicit rfft_plan(std::size_t size):
+            _size{checked_size(size)},
+            _half(size / 2),
+            _twiddles(size / 2 + 1),
+            _buffer(size / 2){
+            for(std::size_t k = 0; k <= size / 2; k++)
+                _twiddles[k] = impl::twiddle(k, size, false);
+        }
+
+        std::size_t size()const noexcept{
+            return _size;
+        }
+
+        // in has size() samples, out size() / 2 + 1 bins
+        void forward(memory_view<const float> in, memory_view<std::complex<float>> out){
+            using impl::complex;
+            const std::size_t h = _size / 2;
+            if(in.size() != _size || out.size() != h + 1)
+                impl::throw_out_of_range("memory_view::rfft_plan::forward");
+
+            std::memcpy(static_cast<void*>(_buffer.data()), in.data(), _size * sizeof(float));
+            _half.forward(memory_view<complex>(_buffer));
+
+            const complex* z = _buffer.data();
+            for(std::size_t k = 0; k <= h; k++){
+                const complex zk  = z[k == h ? 0 : k];
+                const complex zn  = std::conj(z[k == 0 ? 0 : h - k]);
+                const complex even = (zk + zn) * 0.5f;
+                const complex odd  = impl::cmul(zk - zn, complex(0.0f, -0.5f));
+                out[k] = even + impl::cmul(_twiddles[k], odd);
+            }
+        }
+
+        // in has size() / 2 + 1 bins, out size() samples
+        void inverse(memory_view<const std::complex<float>> in, memory_view<float> out){
+            using impl::complex;
+            const std::size_t h = _size / 2;
+            if(in.size() != h + 1 || out.size() != _size)
+                impl::throw_out_of_range("memory_view::rfft_plan::inverse");
+
+            for(std::size_t k = 0; k < h; k++){
+                const complex xk   = in[k];
+                const complex xn   = std::conj(in[h - k]);
+                const complex even = xk + xn;
+                const complex odd  = impl::cmul(xk - xn, std::conj(_twiddles[k]));
+                _buffer[k] = even + impl::cmul(odd, complex(0.0f, 1.0f));
+            }
+            _half.inverse(memory_view<complex>(_buffer));
+            std::memcpy(out.data(), static_cast<const void*>(_buffer.data()), _size * sizeof(float));
+        }
+    };
+}
+
+#endif /* MEMORY_VIEW_FFT_HPP */
@@ -0,0 +1,292 @@
+/**
+ * @file   memory_view/include/memory_view/gemm.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  single precision GEMM and GEMV over matrix_view
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_GEMM_HPP
+#define MEMORY_VIEW_GEMM_HPP
+
+#include "../memory_view.hpp"
+#include "matrix_view.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#if defined(__AVX2__) && defined(__FMA__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) && defined(__FMA__) || defined(__AVX512F__) */
+
+namespace memory_view{
+    namespace impl{
+        // register blocking (mr x nr tile of C) and cache blocking (kc, mc, nc)
+#if defined(__AVX512F__)
+        inline constexpr std::size_t gemm_mr = 6;
+        inline constexpr std::size_t gemm_nr = 32;
+#elif defined(__AVX2__) && defined(__FMA__)
+        inline constexpr std::size_t gemm_mr = 6;
+        inline constexpr std::size_t gemm_nr = 16;
+#else
+        inline constexpr std::size_t gemm_mr = 4;
+        inline constexpr std::size_t gemm_nr = 8;
+#endif /* defined(__AVX512F__) */
+        inline constexpr std::size_t gemm_kc = 256;
+        inline constexpr std::size_t gemm_mc = gemm_mr * 24;
+        inline constexpr std::size_t gemm_nc = gemm_nr * 128;
+
+        // acc (mr x nr, row major) = packed a sliver (kc x mr) * packed b sliver (kc x nr)
+        inline void gemm_microkernel(std::size_t kc, const float* a, const float* b, float* acc)noexcept{
+#if defined(__AVX512F__)
+            __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+            __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+            __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+            __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+            __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+            __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+            for(std::size_t p = 0; p < kc; p++, a += gemm_mr, b += gemm_nr){
+                const __m512 b0 = _mm512_loadu_ps(b);
+                const __m512 b1 = _mm512_loadu_ps(b + 16);
+                __m512 ai;
+                ai = _mm512_set1_ps(a[0]); c00 = _mm512_fmadd_ps(ai, b0, c00); c01 = _mm512_fmadd_ps(ai, b1, c01);
+                ai = _mm512_set1_ps(a[1]); c10 = _mm512_fmadd_ps(ai, b0, c10); c11 = _mm512_fmadd_ps(ai, b1, c11);
+                ai = _mm512_set1_ps(a[2]); c20 = _mm512_fmadd_ps(ai, b0, c20); c21 = _mm512_fmadd_ps(ai, b1, c21);
+                ai = _mm512_set1_ps(a[3]); c30 = _mm512_fmadd_ps(ai, b0, c30); c31 = _mm512_fmadd_ps(ai, b1, c31);
+                ai = _mm512_set1_ps(a[4]); c40 = _mm512_fmadd_ps(ai, b0, c40); c41 = _mm512_fmadd_ps(ai, b1, c41);
+                ai = _mm512_set1_ps(a[5]); c50 = _mm512_fmadd_ps(ai, b0, c50); c51 = _mm512_fmadd_ps(ai, b1, c51);
+            }
+            _mm512_storeu_ps(acc + 0 * gemm_nr, c00); _mm512_storeu_ps(acc + 0 * gemm_nr + 16, c01);
+            _mm512_storeu_ps(acc + 1 * gemm_nr, c10); _mm512_storeu_ps(acc + 1 * gemm_nr + 16, c11);
+            _mm512_storeu_ps(acc + 2 * gemm_nr, c20); _mm512_storeu_ps(acc + 2 * gemm_nr + 16, c21);
+            _mm512_storeu_ps(acc + 3 * gemm_nr, c30); _mm512_storeu_ps(acc + 3 * gemm_nr + 16, c31);
+            _mm512_storeu_ps(acc + 4 * gemm_nr, c40); _mm512_storeu_ps(acc + 4 * gemm_nr + 16, c41);
+            _mm512_storeu_ps(acc + 5 * gemm_nr, c50); _mm512_storeu_ps(acc + 5 * gemm_nr + 16, c51);
+#elif defined(__AVX2__) && defined(__FMA__)
+            __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+            __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+            __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+            __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+            __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+            __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+            for(std::size_t p = 0; p < kc; p++, a += gemm_mr, b += gemm_nr){
+                const __m256 b0 = _mm256_loadu_ps(b);
+                const __m256 b1 = _mm256_loadu_ps(b + 8);
+                __m256 ai;
+                ai = _mm256_broadcast_ss(a + 0); c00 = _mm256_fmadd_ps(ai, b0, c00); c01 = _mm256_fmadd_ps(ai, b1, c01);
+                ai = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(ai, b0, c10); c11 = _mm256_fmadd_ps(ai, b1, c11);
+                ai = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(ai, b0, c20); c21 = _mm256_fmadd_ps(ai, b1, c21);
+                ai = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(ai, b0, c30); c31 = _mm256_fmadd_ps(ai, b1, c31);
+                ai = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(ai, b0, c40); c41 = _mm256_fmadd_ps(ai, b1, c41);
+                ai = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(ai, b0, c50); c51 = _mm256_fmadd_ps(ai, b1, c51);
+            }
+            _mm256_storeu_ps(acc + 0 * gemm_nr, c00); _mm256_storeu_ps(acc + 0 * gemm_nr + 8, c01);
+            _mm256_storeu_ps(acc + 1 * gemm_nr, c10); _mm256_storeu_ps(acc + 1 * gemm_nr + 8, c11);
+            _mm256_storeu_ps(acc + 2 * gemm_nr, c20); _mm256_storeu_ps(acc + 2 * gemm_nr + 8, c21);
+            _mm256_storeu_ps(acc + 3 * gemm_nr, c30); _mm256_storeu_ps(acc + 3 * gemm_nr + 8, c31);
+            _mm256_storeu_ps(acc + 4 * gemm_nr, c40); _mm256_storeu_ps(acc + 4 * gemm_nr + 8, c41);
+            _mm256_storeu_ps(acc + 5 * gemm_nr, c50); _mm256_storeu_ps(acc + 5 * gemm_nr + 8, c51);
+#else
+            float c[gemm_mr][gemm_nr] = {};
+            for(std::size_t p = 0; p < kc; p++, a += gemm_mr, b += gemm_nr)
+                for(std::size_t i = 0; i < gemm_mr; i++)
+                    for(std::size_t j = 0; j < gemm_nr; j++)
+                        c[i][j] += a[i] * b[j];
+            for(std::size_t i = 0; i < gemm_mr; i++)
+                for(std::size_t j = 0; j < gemm_nr; j++)
+                    acc[i * gemm_nr + j] = c[i][j];
+#endif /* defined(__AVX512F__) */
+        }
+
+        // pack a (mc x kc) into slivers of mr rows, k major, zero padded
+        inline void gemm_pack_a(matrix_view<const float> a, float* dst)noexcept{
+            for(std::size_t i = 0; i < a.rows(); i += gemm_mr){
+                const std::size_t mr = std::min(gemm_mr, a.rows() - i);
+                for(std::size_t p = 0; p < a.cols(); p++){
+                    for(std::size_t r = 0; r < mr; r++)
+                        dst[r] = a(i + r, p);
+                    for(std::size_t r = mr; r < gemm_mr; r++)
+                        dst[r] = 0.0f;
+                    dst += gemm_mr;
+                }
+            }
+        }
+
+        // pack b (kc x nc) into slivers of nr columns, k major, zero padded
+        inline void gemm_pack_b(matrix_view<const float> b, float* dst)noexcept{
+            for(std::size_t j = 0; j < b.cols(); j += gemm_nr){
+                const std::size_t nr = std::min(gemm_nr, b.cols() - j);
+                for(std::size_t p = 0; p < b.rows(); p++){
+                    const float* src = b.row(p).data() + j;
+                    for(std::size_t c = 0; c < nr; c++)
+                        dst[c] = src[c];
+                    for(std::size_t c = nr; c < gemm_nr; c++)
+                        dst[c] = 0.0f;
+                    dst += gemm_nr;
+                }
+            }
+        }
+
+        // pack the kc x nc panel of b once, the slivers are split over threads
+        inline void gemm_pack_b_panel(matrix_view<const float> b, float* dst, std::size_t threads){
+            const std::size_t slivers = (b.cols() + gemm_nr - 1) / gemm_nr;
+            parallel_for(slivers, threads, [&](std::size_t begin, std::size_t end){
+                const std::size_t first = begin * gemm_nr;
+                const std::size_t cols = std::min(end * gemm_nr, b.cols()) - first;
+                gemm_pack_b(b.block(0, first, b.rows(), cols), dst + first * b.rows());
+            }, 8);
+        }
+
+        // c = alpha * a * packed b + beta * c, a is m x kc and c m x nc, packed_a holds gemm_mc x gemm_kc
+        inline void gemm_panel(float alpha, matrix_view<const float> a, const float* packed_b,
+                               float beta, matrix_view<float> c, float* packed_a)noexcept{
+            const std::size_t kc = a.cols();
+            const std::size_t nc = c.cols();
+            float acc[gemm_mr * gemm_nr];
+
+            for(std::size_t ic = 0; ic < a.rows(); ic += gemm_mc){
+                const std::size_t mc = std::min(gemm_mc, a.rows() - ic);
+                gemm_pack_a(a.block(ic, 0, mc, kc), packed_a);
+
+                for(std::size_t jr = 0; jr < nc; jr += gemm_nr){
+                    const std::size_t nr = std::min(gemm_nr, nc - jr);
+                    for(std::size_t ir = 0; ir < mc; ir += gemm_mr){
+                        const std::size_t mr = std::min(gemm_mr, mc - ir);
+                        gemm_microkernel(kc, packed_a + ir * kc, packed_b + jr * kc, acc);
+
+                        for(std::size_t i = 0; i < mr; i++){
+                            float* dst = c.row(ic + ir + i).data() + jr;
+                            const float* src = acc + i * gemm_nr;
+                            if(beta == 0.0f)
+                                for(std::size_t j = 0; j < nr; j++)
+                                    dst[j] = alpha * src[j];
+                            else
+                                for(std::size_t j = 0; j < nr; j++)
+                                    dst[j] = alpha * src[j] + beta * dst[j];
+                        }
+                    }
+                }
+            }
+        }
+
+        inline float dot(const float* a, const float* b, std::size_t n)noexcept{
+            std::size_t i = 0;
+            float sum = 0.0f;
+#if defined(__AVX2__) && defined(__FMA__)
+            __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+            __m256 s2 = _mm256_setzero_ps(), s3 = _mm256_setzero_ps();
+            for(; i + 32 <= n; i += 32){
+                s0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i +  0), _mm256_loadu_ps(b + i +  0), s0);
+                s1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i +  8), _mm256_loadu_ps(b + i +  8), s1);
+                s2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 16), _mm256_loadu_ps(b + i + 16), s2);
+                s3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 24), _mm256_loadu_ps(b + i + 24), s3);
+            }
+            for(; i + 8 <= n; i += 8)
+                s0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), s0);
+            const __m256 s = _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3));
+            __m128 h = _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+            h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+            h = _mm_add_ss(h, _mm_movehdup_ps(h));
+            sum = _mm_cvtss_f32(h);
+#else
+            // independent partial sums, the compiler maps them onto vector lanes
+            float partial[8] = {};
+            for(; i + 8 <= n; i += 8)
+                for(std::size_t j = 0; j < 8; j++)
+                    partial[j] += a[i + j] * b[i + j];
+            for(std::size_t j = 0; j < 8; j++)
+                sum += partial[j];
+#endif /* defined(__AVX2__) && defined(__FMA__) */
+            for(; i < n; i++)
+                sum += a[i] * b[i];
+            return sum;
+        }
+    }
+
+    /**
+     * c = alpha * a * b + beta * c
+     *
+     * a is m x k, b is k x n and c is m x n, c must not overlap a or b.
+     * With beta == 0 c is not read. Every panel of b is packed once and
+     * shared, the rows of c are split over threads which pack their own panels of a.
+     */
+    inline void gemm(float alpha, matrix_view<const float> a, matrix_view<const float> b,
+                     float beta, matrix_view<float> c, std::size_t threads = 1){
+        if(a.rows() != c.rows() || b.cols() != c.cols() || a.cols() != b.rows())
+            impl::throw_out_of_range("memory_view::gemm");
+        if(c.empty())
+            return;
+        if(a.cols() == 0){
+            // the product is empty, only beta * c remains
+            for(std::size_t r = 0; r < c.rows(); r++)
+                for(std::size_t j = 0; j < c.cols(); j++)
+                    c(r, j) = beta == 0.0f ? 0.0f : beta * c(r, j);
+            return;
+        }
+
+        const std::size_t m = c.rows();
+        const std::size_t n = c.cols();
+        const std::size_t k = a.cols();
+        std::vector<float> packed_b(impl::gemm_kc * ((std::min(impl::gemm_nc, n) + impl::gemm_nr - 1) / impl::gemm_nr * impl::gemm_nr));
+
+        for(std::size_t jc = 0; jc < n; jc += impl::gemm_nc){
+            const std::size_t nc = std::min(impl::gemm_nc, n - jc);
+            for(std::size_t pc = 0; pc < k; pc += impl::gemm_kc){
+                const std::size_t kc = std::min(impl::gemm_kc, k - pc);
+                // beta only applies to the first panel, later panels accumulate
+                const float panel_beta = pc == 0 ? beta : 1.0f;
+                impl::gemm_pack_b_panel(b.block(pc, jc, kc, nc), packed_b.data(), threads);
+
+                parallel_for(m, threads, [&](std::size_t begin, std::size_t end){
+                    std::vector<float> packed_a(impl::gemm_mc * impl::gemm_kc);
+                    impl::gemm_panel(alpha, a.block(begin, pc, end - begin, kc), packed_b.data(),
+                                     panel_beta, c.block(begin, jc, end - begin, nc), packed_a.data());
+                }, impl::gemm_mc);
+            }
+        }
+    }
+
+    /**
+     * y = alpha * a * x + beta * y
+     *
+     * a is m x n, x has n and y m elements. With beta == 0 y is not read.
+     */
+    inline void gemv(float alpha, matrix_view<const float> a, memory_view<const float> x,
+                     float beta, memory_view<float> y, std::size_t threads = 1){
+        if(a.rows() != y.size() || a.cols() != x.size())
+            impl::throw_out_of_range("memory_view::gemv");
+
+        parallel_for(a.rows(), threads, [&](std::size_t begin, std::size_t end){
+            for(std::size_t i = begin; i < end; i++){
+                const float dot = impl::dot(a.row(i).data(), x.data(), x.size());
+                y[i] = beta == 0.0f ? alpha * dot : alpha * dot + beta * y[i];
+            }
+        }, 64);
+    }
+}
+
+#endif /* MEMORY_VIEW_GEMM_HPP */
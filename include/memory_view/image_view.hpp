@@ -0,0 +1,557 @@
+/**
+ * @file   memory_view/include/memory_view/image_view.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  8 bit pixel views with layout and color conversions
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_IMAGE_VIEW_HPP
+#define MEMORY_VIEW_IMAGE_VIEW_HPP
+
+#include "../memory_view.hpp"
+#include "matrix_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif /* defined(__SSSE3__) */
+
+namespace memory_view{
+    // interleaved 8 bit pixel formats, named by the byte order in memory
+    enum class pixel_format{
+        gray8,
+        rgb24,
+        bgr24,
+        rgba32,
+        bgra32,
+    };
+
+    constexpr std::size_t channels(pixel_format format)noexcept{
+        switch(format){
+        case pixel_format::gray8:  return 1;
+        case pixel_format::rgb24:  return 3;
+        case pixel_format::bgr24:  return 3;
+        case pixel_format::rgba32: return 4;
+        case pixel_format::bgra32: return 4;
+        default:                   return 0;
+        }
+    }
+
+    // YCbCr conversion matrix, all conversions use limited (studio) range
+    enum class yuv_matrix{
+        bt601,
+        bt709,
+    };
+
+    /**
+     * An interleaved image, the rows are pitch bytes apart.
+     * T is std::uint8_t or const std::uint8_t.
+     */
+    template<typename T>
+    class image_view{
+        matrix_view<T> _pixels;
+        pixel_format   _format;
+
+    public:
+        using value_type = T;
+        using size_type  = std::size_t;
+
+        constexpr image_view()noexcept:
+            _pixels{},
+            _format{pixel_format::gray8}{}
+
+        // the view must hold all rows
+        constexpr image_view(memory_view<T> data, pixel_format format,
+                             size_type width, size_type height, size_type pitch):
+            _pixels(data, height, width * ::memory_view::channels(format), pitch),
+            _format{format}{}
+
+        constexpr image_view(memory_view<T> data, pixel_format format, size_type width, size_type height):
+            image_view(data, format, width, height, width * ::memory_view::channels(format)){}
+
+        template<typename U,
+                 typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr image_view(image_view<U> other)noexcept:
+            _pixels{other.pixels()},
+            _format{other.format()}{}
+
+        constexpr pixel_format format()const noexcept{
+            return _format;
+        }
+        constexpr size_type channels()const noexcept{
+            return ::memory_view::channels(_format);
+        }
+        constexpr size_type width()const noexcept{
+            return channels() == 0 ? 0 : _pixels.cols() / channels();
+        }
+        constexpr size_type height()const noexcept{
+            return _pixels.rows();
+        }
+        constexpr size_type pitch()const noexcept{
+            return _pixels.stride();
+        }
+
+        // the image as a height x (width * channels) matrix of bytes
+        constexpr matrix_view<T> pixels()const noexcept{
+            return _pixels;
+        }
+        constexpr memory_view<T> row(size_type y)const noexcept{
+            return _pixels.row(y);
+        }
+    };
+
+    namespace impl{
+        // byte offsets of r, g, b and a in a pixel, a is npos without alpha
+        struct channel_layout{
+            std::size_t r, g, b, a;
+        };
+        inline constexpr std::size_t no_channel = static_cast<std::size_t>(-1);
+
+        constexpr channel_layout layout(pixel_format format)noexcept{
+            switch(format){
+            case pixel_format::gray8:  return {0, 0, 0, no_channel};
+            case pixel_format::rgb24:  return {0, 1, 2, no_channel};
+            case pixel_format::bgr24:  return {2, 1, 0, no_channel};
+            case pixel_format::rgba32: return {0, 1, 2, 3};
+            case pixel_format::bgra32: return {2, 1, 0, 3};
+            default:                   return {0, 0, 0, no_channel};
+            }
+        }
+
+        inline std::uint8_t clamp_u8(int v)noexcept{
+            return static_cast<std::uint8_t>(std::clamp(v, 0, 255));
+        }
+
+        // 8.8 fixed point coefficients
+        struct yuv_coefficients{
+            int yr, yg, yb;
+            int ur, ug, ub;
+            int vr, vg, vb;
+            int ry, rv, gu, gv, bu;
+        };
+
+        constexpr yuv_coefficients coefficients(yuv_matrix m)noexcept{
+            if(m == yuv_matrix::bt709)
+                return {47, 157, 16, -26, -87, 112, 112, -102, -10, 298, 459, -55, -136, 541};
+            return {66, 129, 25, -38, -74, 112, 112, -94, -18, 298, 409, -100, -208, 516};
+        }
+
+        inline void check_planes(std::size_t width, std::size_t height, const matrix_view<const std::uint8_t>* planes,
+                                 std::size_t count, const char* what){
+            for(std::size_t i = 0; i < count; i++)
+                if(planes[i].cols() != width || planes[i].rows() != height)
+                    impl::throw_out_of_range(what);
+        }
+
+#if defined(__SSSE3__)
+        // pshufb masks for converting 4 pixels of 4 channels or 5 pixels of 3 channels
+        inline __m128i swizzle_mask(channel_layout from, channel_layout to, std::size_t ch)noexcept{
+            alignas(16) std::int8_t mask[16];
+            const std::size_t pixels = 16 / ch;
+            // bytes outside of a whole pixel are copied unchanged, which keeps in place conversion valid
+            for(std::size_t i = 0; i < 16; i++)
+                mask[i] = static_cast<std::int8_t>(i);
+            for(std::size_t p = 0; p < pixels; p++){
+                mask[p * ch + to.r] = static_cast<std::int8_t>(p * ch + from.r);
+                mask[p * ch + to.g] = static_cast<std::int8_t>(p * ch + from.g);
+                mask[p * ch + to.b] = static_cast<std::int8_t>(p * ch + from.b);
+                if(ch == 4)
+                    mask[p * ch + to.a] = static_cast<std::int8_t>(p * ch + from.a);
+            }
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+        }
+
+        // 16 pixels of 3 channels are 48 bytes in 3 registers, byte 3 * p + c is channel c of pixel p
+        struct rgb_shuffles{
+            __m128i split[3][3]; // split[register][channel], gathers the channel bytes of one register
+            __m128i merge[3][3]; // merge[register][channel], scatters one channel into one register
+
+            rgb_shuffles()noexcept{
+                alignas(16) std::int8_t mask[16];
+                for(std::size_t reg = 0; reg < 3; reg++){
+                    for(std::size_t c = 0; c < 3; c++){
+                        // -128 clears the byte so the three shuffles can be ored together
+                        for(std::size_t p = 0; p < 16; p++){
+                            const std::size_t q = 3 * p + c;
+                            mask[p] = static_cast<std::int8_t>(q / 16 == reg ? q % 16 : 0x80);
+                        }
+                        split[reg][c] = _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+                        for(std::size_t i = 0; i < 16; i++){
+                            const std::size_t q = 16 * reg + i;
+                            mask[i] = static_cast<std::int8_t>(q % 3 == c ? q / 3 : 0x80);
+                        }
+                        merge[reg][c] = _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+                    }
+                }
+            }
+        };
+
+        // one register per channel from 16 interleaved pixels
+        inline void load_planar(const std::uint8_t* in, const rgb_shuffles& s, __m128i (&out)[3])noexcept{
+            const __m128i v[3] = {
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32)),
+            };
+            for(std::size_t c = 0; c < 3; c++)
+                out[c] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v[0], s.split[0][c]),
+                                                   _mm_shuffle_epi8(v[1], s.split[1][c])),
+                                      _mm_shuffle_epi8(v[2], s.split[2][c]));
+        }
+
+        inline void load_planar(const std::uint8_t* in, const rgb_shuffles&, __m128i (&out)[4])noexcept{
+            // group the channels of 4 pixels into 32 bit lanes, then transpose the 4x4 lanes
+            const __m128i mask = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+            __m128i v[4];
+            for(std::size_t i = 0; i < 4; i++)
+                v[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16 * i)), mask);
+            const __m128i t0 = _mm_unpacklo_epi32(v[0], v[1]);
+            const __m128i t1 = _mm_unpacklo_epi32(v[2], v[3]);
+            const __m128i t2 = _mm_unpackhi_epi32(v[0], v[1]);
+            const __m128i t3 = _mm_unpackhi_epi32(v[2], v[3]);
+            out[0] = _mm_unpacklo_epi64(t0, t1);
+            out[1] = _mm_unpackhi_epi64(t0, t1);
+            out[2] = _mm_unpacklo_epi64(t2, t3);
+            out[3] = _mm_unpackhi_epi64(t2, t3);
+        }
+
+        // 16 interleaved pixels from one register per channel
+        inline void store_interleaved(std::uint8_t* out, const rgb_shuffles& s, const __m128i (&in)[3])noexcept{
+            for(std::size_t reg = 0; reg < 3; reg++){
+                const __m128i v = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(in[0], s.merge[reg][0]),
+                                                            _mm_shuffle_epi8(in[1], s.merge[reg][1])),
+                                               _mm_shuffle_epi8(in[2], s.merge[reg][2]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16 * reg), v);
+            }
+        }
+
+        inline void store_interleaved(std::uint8_t* out, const rgb_shuffles&, const __m128i (&in)[4])noexcept{
+            const __m128i lo01 = _mm_unpacklo_epi8(in[0], in[1]);
+            const __m128i hi01 = _mm_unpackhi_epi8(in[0], in[1]);
+            const __m128i lo23 = _mm_unpacklo_epi8(in[2], in[3]);
+            const __m128i hi23 = _mm_unpackhi_epi8(in[2], in[3]);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out),      _mm_unpacklo_epi16(lo01, lo23));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi16(lo01, lo23));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 32), _mm_unpacklo_epi16(hi01, hi23));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 48), _mm_unpackhi_epi16(hi01, hi23));
+        }
+
+        // (a * r + b * g + c * b + offset) >> 8 of 16 pixels, the 8.8 sums of the forward conversion are
+        // within [0, 65536) so the wrapping 16 bit arithmetic is exact
+        inline __m128i weighted_sum(const __m128i (&rgb)[3], int a, int b, int c, int offset)noexcept{
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i ka = _mm_set1_epi16(static_cast<short>(a));
+            const __m128i kb = _mm_set1_epi16(static_cast<short>(b));
+            const __m128i kc = _mm_set1_epi16(static_cast<short>(c));
+            const __m128i ko = _mm_set1_epi16(static_cast<short>(offset));
+            const auto half = [&](__m128i r, __m128i g, __m128i bl){
+                __m128i sum = _mm_add_epi16(_mm_mullo_epi16(r, ka), ko);
+                sum = _mm_add_epi16(sum, _mm_mullo_epi16(g, kb));
+                sum = _mm_add_epi16(sum, _mm_mullo_epi16(bl, kc));
+                return _mm_srli_epi16(sum, 8);
+            };
+            const __m128i lo = half(_mm_unpacklo_epi8(rgb[0], zero), _mm_unpacklo_epi8(rgb[1], zero), _mm_unpacklo_epi8(rgb[2], zero));
+            const __m128i hi = half(_mm_unpackhi_epi8(rgb[0], zero), _mm_unpackhi_epi8(rgb[1], zero), _mm_unpackhi_epi8(rgb[2], zero));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        // clamp((a * x + b * y + c * z + 128) >> 8) of 16 pixels with x, y, z as 16 bit lanes,
+        // pmaddwd sums the pairs in 32 bit since the inverse conversion exceeds 16 bits
+        inline __m128i clamped_sum(const __m128i (&x)[2], const __m128i (&y)[2], const __m128i (&z)[2],
+                                   int a, int b, int c)noexcept{
+            const __m128i kab = _mm_set1_epi32(static_cast<int>((static_cast<unsigned>(b) << 16) | (static_cast<unsigned>(a) & 0xffff)));
+            const __m128i kc1 = _mm_set1_epi32(static_cast<int>((128u << 16) | (static_cast<unsigned>(c) & 0xffff)));
+            const __m128i one = _mm_set1_epi16(1);
+            __m128i words[2];
+            for(std::size_t h = 0; h < 2; h++){
+                const __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(x[h], y[h]), kab),
+                                                 _mm_madd_epi16(_mm_unpacklo_epi16(z[h], one), kc1));
+                const __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(x[h], y[h]), kab),
+                                                 _mm_madd_epi16(_mm_unpackhi_epi16(z[h], one), kc1));
+                words[h] = _mm_packs_epi32(_mm_srai_epi32(lo, 8), _mm_srai_epi32(hi, 8));
+            }
+            return _mm_packus_epi16(words[0], words[1]);
+        }
+#endif /* defined(__SSSE3__) */
+    }
+
+    /**
+     * Convert between interleaved formats of the same size.
+     * Missing alpha is set to 255, gray is replicated into r, g and b and
+     * colors are converted to gray with BT.601 luma weights.
+     * src and dst must not overlap unless they are the same image.
+     */
+    inline void convert(image_view<const std::uint8_t> src, image_view<std::uint8_t> dst){
+        if(src.width() != dst.width() || src.height() != dst.height())
+            impl::throw_out_of_range("memory_view::convert");
+
+        const impl::channel_layout from = impl::layout(src.format());
+        const impl::channel_layout to   = impl::layout(dst.format());
+        const std::size_t sc = src.channels();
+        const std::size_t dc = dst.channels();
+        const std::size_t width = src.width();
+
+        for(std::size_t y = 0; y < src.height(); y++){
+            const std::uint8_t* in = src.row(y).data();
+            std::uint8_t* out = dst.row(y).data();
+            std::size_t x = 0;
+
+            if(dst.format() == pixel_format::gray8){
+                for(; x < width; x++){
+                    const std::uint8_t* p = in + x * sc;
+                    out[x] = static_cast<std::uint8_t>((77 * p[from.r] + 150 * p[from.g] + 29 * p[from.b] + 128) >> 8);
+                }
+                continue;
+            }
+
+#if defined(__SSSE3__)
+            if(sc == dc && sc != 1){
+                // 16 byte loads and stores, the last byte of a 3 channel block belongs to the next block
+                const __m128i mask = impl::swizzle_mask(from, to, sc);
+                const std::size_t step = 16 / sc;
+                for(; (x + step) * sc + (sc == 3 ? 1 : 0) <= width * sc; x += step){
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x * sc));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * dc), _mm_shuffle_epi8(v, mask));
+                }
+            }
+#endif /* defined(__SSSE3__) */
+
+            for(; x < width; x++){
+                const std::uint8_t* p = in + x * sc;
+                std::uint8_t* q = out + x * dc;
+                const std::uint8_t r = p[from.r];
+                const std::uint8_t g = p[from.g];
+                const std::uint8_t b = p[from.b];
+                const std::uint8_t a = from.a == impl::no_channel ? 255 : p[from.a];
+                q[to.r] = r;
+                q[to.g] = g;
+                q[to.b] = b;
+                if(to.a != impl::no_channel)
+                    q[to.a] = a;
+            }
+        }
+    }
+
+    /**
+     * Split an interleaved image into one plane per channel (in memory order).
+     */
+    template<std::size_t N>
+    void deinterleave(image_view<const std::uint8_t> src, const std::array<matrix_view<std::uint8_t>, N>& planes){
+        if(src.channels() != N)
+            impl::throw_out_of_range("memory_view::deinterleave");
+        for(const auto& plane : planes)
+            if(plane.cols() != src.width() || plane.rows() != src.height())
+                impl::throw_out_of_range("memory_view::deinterleave");
+
+#if defined(__SSSE3__)
+        const impl::rgb_shuffles shuffles;
+#endif /* defined(__SSSE3__) */
+        for(std::size_t y = 0; y < src.height(); y++){
+            const std::uint8_t* in = src.row(y).data();
+            std::array<std::uint8_t*, N> out;
+            for(std::size_t c = 0; c < N; c++)
+                out[c] = planes[c].row(y).data();
+            std::size_t x = 0;
+#if defined(__SSSE3__)
+            if constexpr(N == 3 || N == 4){
+                for(; x + 16 <= src.width(); x += 16){
+                    __m128i v[N];
+                    impl::load_planar(in + x * N, shuffles, v);
+                    for(std::size_t c = 0; c < N; c++)
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out[c] + x), v[c]);
+                }
+            }
+#endif /* defined(__SSSE3__) */
+            for(; x < src.width(); x++)
+                for(std::size_t c = 0; c < N; c++)
+                    out[c][x] = in[x * N + c];
+        }
+    }
+
+    /**
+     * Merge one plane per channel (in memory order) into an interleaved image.
+     */
+    template<std::size_t N>
+    void interleave(const std::array<matrix_view<const std::uint8_t>, N>& planes, image_view<std::uint8_t> dst){
+        if(dst.channels() != N)
+            impl::throw_out_of_range("memory_view::interleave");
+        impl::check_planes(dst.width(), dst.height(), planes.data(), N, "memory_view::interleave");
+
+#if defined(__SSSE3__)
+        const impl::rgb_shuffles shuffles;
+#endif /* defined(__SSSE3__) */
+        for(std::size_t y = 0; y < dst.height(); y++){
+            std::uint8_t* out = dst.row(y).data();
+            std::array<const std::uint8_t*, N> in;
+            for(std::size_t c = 0; c < N; c++)
+                in[c] = planes[c].row(y).data();
+            std::size_t x = 0;
+#if defined(__SSSE3__)
+            if constexpr(N == 3 || N == 4){
+                for(; x + 16 <= dst.width(); x += 16){
+                    __m128i v[N];
+                    for(std::size_t c = 0; c < N; c++)
+                        v[c] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in[c] + x));
+                    impl::store_interleaved(out + x * N, shuffles, v);
+                }
+            }
+#endif /* defined(__SSSE3__) */
+            for(; x < dst.width(); x++)
+                for(std::size_t c = 0; c < N; c++)
+                    out[x * N + c] = in[c][x];
+        }
+    }
+
+    /**
+     * Convert an rgb, bgr, rgba or bgra image to planar YUV 4:4:4 (y, u, v planes).
+     */
+    inline void rgb_to_yuv(image_view<const std::uint8_t> src, const std::array<matrix_view<std::uint8_t>, 3>& yuv,
+                           yuv_matrix matrix = yuv_matrix::bt601){
+        if(src.channels() < 3)
+            impl::throw_out_of_range("memory_view::rgb_to_yuv");
+        for(const auto& plane : yuv)
+            if(plane.cols() != src.width() || plane.rows() != src.height())
+                impl::throw_out_of_range("memory_view::rgb_to_yuv");
+
+        const impl::yuv_coefficients k = impl::coefficients(matrix);
+        const impl::channel_layout from = impl::layout(src.format());
+        const std::size_t sc = src.channels();
+#if defined(__SSSE3__)
+        const impl::rgb_shuffles shuffles;
+#endif /* defined(__SSSE3__) */
+
+        for(std::size_t y = 0; y < src.height(); y++){
+            const std::uint8_t* in = src.row(y).data();
+            std::uint8_t* py = yuv[0].row(y).data();
+            std::uint8_t* pu = yuv[1].row(y).data();
+            std::uint8_t* pv = yuv[2].row(y).data();
+            std::size_t x = 0;
+#if defined(__SSSE3__)
+            for(; x + 16 <= src.width(); x += 16){
+                __m128i rgb[3];
+                if(sc == 3){
+                    __m128i v[3];
+                    impl::load_planar(in + x * sc, shuffles, v);
+                    rgb[0] = v[from.r];
+                    rgb[1] = v[from.g];
+                    rgb[2] = v[from.b];
+                }else{
+                    __m128i v[4];
+                    impl::load_planar(in + x * sc, shuffles, v);
+                    rgb[0] = v[from.r];
+                    rgb[1] = v[from.g];
+                    rgb[2] = v[from.b];
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(py + x), impl::weighted_sum(rgb, k.yr, k.yg, k.yb, (16 << 8) + 128));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pu + x), impl::weighted_sum(rgb, k.ur, k.ug, k.ub, (128 << 8) + 128));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pv + x), impl::weighted_sum(rgb, k.vr, k.vg, k.vb, (128 << 8) + 128));
+            }
+#endif /* defined(__SSSE3__) */
+            for(; x < src.width(); x++){
+                const int r = in[x * sc + from.r];
+                const int g = in[x * sc + from.g];
+                const int b = in[x * sc + from.b];
+                // the offsets keep the sums positive before the shift
+                py[x] = static_cast<std::uint8_t>((k.yr * r + k.yg * g + k.yb * b + (16 << 8) + 128) >> 8);
+                pu[x] = static_cast<std::uint8_t>((k.ur * r + k.ug * g + k.ub * b + (128 << 8) + 128) >> 8);
+                pv[x] = static_cast<std::uint8_t>((k.vr * r + k.vg * g + k.vb * b + (128 << 8) + 128) >> 8);
+            }
+        }
+    }
+
+    /**
+     * Convert planar YUV 4:4:4 (y, u, v planes) to an rgb, bgr, rgba or bgra image,
+     * alpha is set to 255.
+     */
+    inline void yuv_to_rgb(const std::array<matrix_view<const std::uint8_t>, 3>& yuv, image_view<std::uint8_t> dst,
+                           yuv_matrix matrix = yuv_matrix::bt601){
+        if(dst.channels() < 3)
+            impl::throw_out_of_range("memory_view::yuv_to_rgb");
+        impl::check_planes(dst.width(), dst.height(), yuv.data(), 3, "memory_view::yuv_to_rgb");
+
+        const impl::yuv_coefficients k = impl::coefficients(matrix);
+        const impl::channel_layout to = impl::layout(dst.format());
+        const std::size_t dc = dst.channels();
+#if defined(__SSSE3__)
+        const impl::rgb_shuffles shuffles;
+#endif /* defined(__SSSE3__) */
+
+        for(std::size_t y = 0; y < dst.height(); y++){
+            const std::uint8_t* py = yuv[0].row(y).data();
+            const std::uint8_t* pu = yuv[1].row(y).data();
+            const std::uint8_t* pv = yuv[2].row(y).data();
+            std::uint8_t* out = dst.row(y).data();
+            std::size_t x = 0;
+#if defined(__SSSE3__)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i y16  = _mm_set1_epi16(16);
+            const __m128i uv0  = _mm_set1_epi16(128);
+            for(; x + 16 <= dst.width(); x += 16){
+                const __m128i vy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(py + x));
+                const __m128i vu = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pu + x));
+                const __m128i vv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pv + x));
+                const __m128i c[2] = {_mm_sub_epi16(_mm_unpacklo_epi8(vy, zero), y16), _mm_sub_epi16(_mm_unpackhi_epi8(vy, zero), y16)};
+                const __m128i d[2] = {_mm_sub_epi16(_mm_unpacklo_epi8(vu, zero), uv0), _mm_sub_epi16(_mm_unpackhi_epi8(vu, zero), uv0)};
+                const __m128i e[2] = {_mm_sub_epi16(_mm_unpacklo_epi8(vv, zero), uv0), _mm_sub_epi16(_mm_unpackhi_epi8(vv, zero), uv0)};
+                const __m128i r = impl::clamped_sum(c, e, d, k.ry, k.rv, 0);
+                const __m128i g = impl::clamped_sum(c, d, e, k.ry, k.gu, k.gv);
+                const __m128i b = impl::clamped_sum(c, d, e, k.ry, k.bu, 0);
+                if(dc == 3){
+                    __m128i v[3];
+                    v[to.r] = r;
+                    v[to.g] = g;
+                    v[to.b] = b;
+                    impl::store_interleaved(out + x * dc, shuffles, v);
+                }else{
+                    __m128i v[4];
+                    v[to.r] = r;
+                    v[to.g] = g;
+                    v[to.b] = b;
+                    v[to.a] = _mm_set1_epi8(-1);
+                    impl::store_interleaved(out + x * dc, shuffles, v);
+                }
+            }
+#endif /* defined(__SSSE3__) */
+            for(; x < dst.width(); x++){
+                const int c = k.ry * (py[x] - 16) + 128;
+                const int d = pu[x] - 128;
+                const int e = pv[x] - 128;
+                out[x * dc + to.r] = impl::clamp_u8((c + k.rv * e) >> 8);
+                out[x * dc + to.g] = impl::clamp_u8((c + k.gu * d + k.gv * e) >> 8);
+                out[x * dc + to.b] = impl::clamp_u8((c + k.bu * d) >> 8);
+                if(to.a != impl::no_channel)
+                    out[x * dc + to.a] = 255;
+            }
+        }
+    }
+}
+
+#endif /* MEMORY_VIEW_IMAGE_VIEW_HPP */
@@ -0,0 +1,239 @@
+/**
+ * @file   memory_view/include/memory_view/matrix_view.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  2-D strided view with tiled copy and transpose
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_MATRIX_VIEW_HPP
+#define MEMORY_VIEW_MATRIX_VIEW_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif /* defined(__SSE__) */
+
+namespace memory_view{
+    /**
+     * A row major 2-D view, the rows are stride elements apart.
+     */
+    template<typename T>
+    class matrix_view{
+        T*          _data;
+        std::size_t _rows;
+        std::size_t _cols;
+        std::size_t _stride;
+
+    public:
+        // types:
+        using value_type      = T;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer         = value_type*;
+        using const_pointer   = const value_type*;
+        using reference       = value_type&;
+        using const_reference = const value_type&;
+
+        constexpr matrix_view()noexcept:
+            _data{nullptr},
+            _rows{0},
+            _cols{0},
+            _stride{0}{}
+
+        // construct from pointer, rows, cols and row stride (in elements)
+        constexpr matrix_view(pointer data, size_type rows, size_type cols, size_type stride)noexcept:
+            _data{data},
+            _rows{rows},
+            _cols{cols},
+            _stride{stride}{}
+
+        constexpr matrix_view(pointer data, size_type rows, size_type cols)noexcept:
+            matrix_view(data, rows, cols, cols){}
+
+        // construct from a memory_view, the view must hold all rows
+        constexpr matrix_view(memory_view<T> view, size_type rows, size_type cols, size_type stride):
+            matrix_view(view.data(), rows, cols, stride){
+            if(stride < cols || (rows != 0 && cols != 0 && view.size() < (rows - 1) * stride + cols))
+                impl::throw_out_of_range("matrix_view::matrix_view");
+        }
+
+        constexpr matrix_view(memory_view<T> view, size_type rows, size_type cols):
+            matrix_view(view, rows, cols, cols){}
+
+        // construct from a matrix_view with a convertible element type
+        template<typename U,
+                 typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr matrix_view(matrix_view<U> other)noexcept:
+            matrix_view(other.data(), other.rows(), other.cols(), other.stride()){}
+
+        // capacity:
+        constexpr bool empty()const noexcept{
+            return rows() == 0 || cols() == 0;
+        }
+        constexpr size_type rows()const noexcept{
+            return _rows;
+        }
+        constexpr size_type cols()const noexcept{
+            return _cols;
+        }
+        constexpr size_type stride()const noexcept{
+            return _stride;
+        }
+        constexpr size_type size()const noexcept{
+            return rows() * cols();
+        }
+        // true if the rows follow each other without padding
+        constexpr bool is_contiguous()const noexcept{
+            return stride() == cols() || rows() <= 1;
+        }
+
+        // element access:
+        constexpr reference operator()(size_type r, size_type c)const noexcept{
+            return _data[r * _stride + c];
+        }
+
+        constexpr pointer data()const noexcept{
+            return _data;
+        }
+
+        constexpr memory_view<T> row(size_type r)const noexcept{
+            return memory_view<T>(_data + r * _stride, _cols);
+        }
+        constexpr matrix_view col(size_type c)const noexcept{
+            return matrix_view(_data + c, _rows, 1, _stride);
+        }
+
+        // rows [r, r + nrows) and columns [c, c + ncols), the counts are capped to the matrix
+        constexpr matrix_view block(size_type r, size_type c, size_type nrows, size_type ncols)const{
+            if(r > rows() || c > cols())
+                impl::throw_out_of_range("matrix_view::block");
+            return matrix_view(_data + r * _stride + c,
+                               std::min(nrows, rows() - r),
+                               std::min(ncols, cols() - c),
+                               _stride);
+        }
+        constexpr matrix_view row_range(size_type r, size_type nrows)const{
+            return block(r, 0, nrows, cols());
+        }
+        constexpr matrix_view col_range(size_type c, size_type ncols)const{
+            return block(0, c, rows(), ncols);
+        }
+    };
+
+    namespace impl{
+        // square tile edge length used by transpose, a src and a dst tile fit into L1
+        template<typename T>
+        inline constexpr std::size_t transpose_tile = std::clamp<std::size_t>(128 / sizeof(T), 8, 64);
+
+        template<typename T>
+        void transpose_block(const T* src, std::size_t src_stride,
+                             T* dst, std::size_t dst_stride,
+                             std::size_t rows, std::size_t cols){
+            std::size_t r = 0;
+#if defined(__SSE__)
+            if constexpr(sizeof(T) == sizeof(float) && std::is_trivially_copyable_v<T>){
+                for(; r + 4 <= rows; r += 4){
+                    std::size_t c = 0;
+                    for(; c + 4 <= cols; c += 4){
+                        __m128 r0, r1, r2, r3;
+                        std::memcpy(&r0, src + (r + 0) * src_stride + c, sizeof(r0));
+                        std::memcpy(&r1, src + (r + 1) * src_stride + c, sizeof(r1));
+                        std::memcpy(&r2, src + (r + 2) * src_stride + c, sizeof(r2));
+                        std::memcpy(&r3, src + (r + 3) * src_stride + c, sizeof(r3));
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                        std::memcpy(dst + (c + 0) * dst_stride + r, &r0, sizeof(r0));
+                        std::memcpy(dst + (c + 1) * dst_stride + r, &r1, sizeof(r1));
+                        std::memcpy(dst + (c + 2) * dst_stride + r, &r2, sizeof(r2));
+                        std::memcpy(dst + (c + 3) * dst_stride + r, &r3, sizeof(r3));
+                    }
+                    for(; c < cols; c++)
+                        for(std::size_t i = r; i < r + 4; i++)
+                            dst[c * dst_stride + i] = src[i * src_stride + c];
+                }
+            }
+#endif /* defined(__SSE__) */
+            for(; r < rows; r++)
+                for(std::size_t c = 0; c < cols; c++)
+                    dst[c * dst_stride + r] = src[r * src_stride + c];
+        }
+    }
+
+    /**
+     * Copy src into dst, both must have the same shape.
+     */
+    template<typename T, typename U>
+    void copy(matrix_view<T> src, matrix_view<U> dst){
+        if(src.rows() != dst.rows() || src.cols() != dst.cols())
+            impl::throw_out_of_range("memory_view::copy");
+        if(src.empty())
+            return;
+
+        if constexpr(std::is_same_v<std::remove_const_t<T>, U> && std::is_trivially_copyable_v<U>){
+            if(src.is_contiguous() && dst.is_contiguous()){
+                std::memcpy(dst.data(), src.data(), src.size() * sizeof(U));
+                return;
+            }
+            for(std::size_t r = 0; r < src.rows(); r++)
+                std::memcpy(dst.row(r).data(), src.row(r).data(), src.cols() * sizeof(U));
+        }else{
+            for(std::size_t r = 0; r < src.rows(); r++)
+                std::copy(src.row(r).begin(), src.row(r).end(), dst.row(r).begin());
+        }
+    }
+
+    /**
+     * Write the transpose of src into dst (dst.rows() == src.cols() and dst.cols() == src.rows()).
+     *
+     * The matrices are processed in square tiles which fit into L1,
+     * 4 byte types are transposed with 4x4 SSE shuffles inside a tile.
+     * src and dst must not overlap, T is U or const U.
+     */
+    template<typename T, typename U>
+    void transpose(matrix_view<T> src, matrix_view<U> dst){
+        static_assert(std::is_same_v<std::remove_const_t<T>, U>, "transpose does not convert between element types");
+        if(src.rows() != dst.cols() || src.cols() != dst.rows())
+            impl::throw_out_of_range("memory_view::transpose");
+
+        constexpr std::size_t tile = impl::transpose_tile<U>;
+        for(std::size_t r = 0; r < src.rows(); r += tile){
+            const std::size_t nr = std::min(tile, src.rows() - r);
+            for(std::size_t c = 0; c < src.cols(); c += tile){
+                const std::size_t nc = std::min(tile, src.cols() - c);
+                impl::transpose_block<U>(src.data() + r * src.stride() + c, src.stride(),
+                                         dst.data() + c * dst.stride() + r, dst.stride(),
+                                         nr, nc);
+            }
+        }
+    }
+}
+
+#endif /* MEMORY_VIEW_MATRIX_VIEW_HPP */
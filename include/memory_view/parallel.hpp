@@ -0,0 +1,103 @@
+/**
+ * @file   memory_view/include/memory_view/parallel.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  split index ranges over threads
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_PARALLEL_HPP
+#define MEMORY_VIEW_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace memory_view{
+    // use one thread per hardware thread
+    inline constexpr std::size_t all_threads = 0;
+
+    namespace impl{
+        inline std::size_t thread_count(std::size_t threads)noexcept{
+            if(threads == all_threads)
+                threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+            return threads;
+        }
+    }
+
+    /**
+     * Split [0, n) into at most threads chunks, every chunk is a multiple
+     * of grain (except the last one), and call f(begin, end) for every chunk.
+     *
+     * The calling thread processes the first chunk, with one chunk f runs
+     * on the calling thread only. All threads are joined before returning,
+     * the first exception thrown by f or by starting a thread is rethrown.
+     */
+    template<typename F>
+    void parallel_for(std::size_t n, std::size_t threads, F f, std::size_t grain = 1){
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t grains = (n + grain - 1) / grain;
+        const std::size_t chunks = std::min(impl::thread_count(threads), grains);
+        if(chunks <= 1){
+            if(n != 0)
+                f(std::size_t{0}, n);
+            return;
+        }
+
+        const auto chunk_begin = [&](std::size_t i){
+            return std::min(n, grains * i / chunks * grain);
+        };
+        // one slot per chunk, so no lock is needed
+        std::vector<std::exception_ptr> errors(chunks);
+        const auto run = [&](F g, std::size_t i){
+            try{
+                g(chunk_begin(i), chunk_begin(i + 1));
+            }catch(...){
+                errors[i] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        try{
+            for(std::size_t i = 1; i < chunks; i++)
+                workers.emplace_back(run, f, i);
+        }catch(...){
+            errors[0] = std::current_exception();
+        }
+        if(!errors[0])
+            run(f, 0);
+        for(auto& worker : workers)
+            worker.join();
+
+        for(const auto& error : errors)
+            if(error)
+                std::rethrow_exception(error);
+    }
+}
+
+#endif /* MEMORY_VIEW_PARALLEL_HPP */
@@ -0,0 +1,253 @@
+/**
+ * @file   memory_view/include/memory_view/pipeline.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  lazy, fused element wise pipelines over memory_view
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_PIPELINE_HPP
+#define MEMORY_VIEW_PIPELINE_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace memory_view{
+    namespace impl{
+        // every stage pushes the elements in [begin, end) into a sink,
+        // the sink is called as sink(index, values...)
+
+        template<typename... Views>
+        class source_stage{
+            std::tuple<Views...> _views;
+
+            template<typename Sink, std::size_t... I>
+            void run(std::size_t begin, std::size_t end, Sink& sink, std::index_sequence<I...>)const{
+                auto data = std::make_tuple(std::get<I>(_views).data()...);
+                for(std::size_t i = begin; i < end; i++)
+                    sink(i, std::get<I>(data)[i]...);
+            }
+
+        public:
+            static constexpr bool dense = true;
+
+            constexpr source_stage(Views... views):
+                _views{views...}{}
+
+            constexpr std::size_t size()const noexcept{
+                return std::get<0>(_views).size();
+            }
+
+            template<typename Sink>
+            void run(std::size_t begin, std::size_t end, Sink& sink)const{
+                run(begin, end, sink, std::index_sequence_for<Views...>{});
+            }
+        };
+
+        template<typename Prev, typename F>
+        class map_stage{
+            Prev _prev;
+            F    _f;
+
+        public:
+            static constexpr bool dense = Prev::dense;
+
+            constexpr map_stage(Prev prev, F f):
+                _prev{std::move(prev)},
+                _f{std::move(f)}{}
+
+            constexpr std::size_t size()const noexcept{
+                return _prev.size();
+            }
+
+            template<typename Sink>
+            void run(std::size_t begin, std::size_t end, Sink& sink)const{
+                auto s = [&](std::size_t i, auto&&... values){
+                    sink(i, _f(std::forward<decltype(values)>(values)...));
+                };
+                _prev.run(begin, end, s);
+            }
+        };
+
+        template<typename Prev, typename P>
+        class filter_stage{
+            Prev _prev;
+            P    _p;
+
+        public:
+            static constexpr bool dense = false;
+
+            constexpr filter_stage(Prev prev, P p):
+                _prev{std::move(prev)},
+                _p{std::move(p)}{}
+
+            constexpr std::size_t size()const noexcept{
+                return _prev.size();
+            }
+
+            template<typename Sink>
+            void run(std::size_t begin, std::size_t end, Sink& sink)const{
+                auto s = [&](std::size_t i, auto&&... values){
+                    if(_p(values...))
+                        sink(i, std::forward<decltype(values)>(values)...);
+                };
+                _prev.run(begin, end, s);
+            }
+        };
+
+        template<typename Prev>
+        class enumerate_stage{
+            Prev _prev;
+
+        public:
+            static constexpr bool dense = Prev::dense;
+
+            constexpr enumerate_stage(Prev prev):
+                _prev{std::move(prev)}{}
+
+            constexpr std::size_t size()const noexcept{
+                return _prev.size();
+            }
+
+            template<typename Sink>
+            void run(std::size_t begin, std::size_t end, Sink& sink)const{
+                auto s = [&](std::size_t i, auto&&... values){
+                    sink(i, i, std::forward<decltype(values)>(values)...);
+                };
+                _prev.run(begin, end, s);
+            }
+        };
+    }
+
+    /**
+     * A lazy chain of element wise operations over one or more memory_views.
+     *
+     * Adapters (map, filter, enumerate) only compose the chain,
+     * the terminal operations (collect_into, reduce, for_each) run all
+     * stages fused in a single loop over the source views.
+     */
+    template<typename Stage>
+    class pipeline{
+        Stage _stage;
+
+    public:
+        // number of elements processed per block by the terminal operations
+        static constexpr std::size_t block_size = 4096;
+
+        constexpr explicit pipeline(Stage stage):
+            _stage{std::move(stage)}{}
+
+        // number of source elements
+        constexpr std::size_t size()const noexcept{
+            return _stage.size();
+        }
+
+        // adapters:
+        template<typename F>
+        constexpr auto map(F f)const{
+            return pipeline<impl::map_stage<Stage, F>>(impl::map_stage<Stage, F>(_stage, std::move(f)));
+        }
+
+        template<typename P>
+        constexpr auto filter(P p)const{
+            return pipeline<impl::filter_stage<Stage, P>>(impl::filter_stage<Stage, P>(_stage, std::move(p)));
+        }
+
+        // prepend the source index to the values
+        constexpr auto enumerate()const{
+            return pipeline<impl::enumerate_stage<Stage>>(impl::enumerate_stage<Stage>(_stage));
+        }
+
+        // terminal operations:
+        template<typename F>
+        void for_each(F f)const{
+            auto sink = [&](std::size_t, auto&&... values){
+                f(std::forward<decltype(values)>(values)...);
+            };
+            _stage.run(0, size(), sink);
+        }
+
+        template<typename T, typename Op>
+        T reduce(T init, Op op)const{
+            auto sink = [&](std::size_t, auto&& value){
+                init = op(std::move(init), std::forward<decltype(value)>(value));
+            };
+            _stage.run(0, size(), sink);
+            return init;
+        }
+
+        /**
+         * Write the resulting values into out, returns the number of values written.
+         * Processing stops once out is full, the stages are not called for the
+         * source elements after the one which filled it.
+         */
+        template<typename U, typename C>
+        std::size_t collect_into(memory_view<U, C> out)const{
+            U* dst = out.data();
+
+            if constexpr(Stage::dense){
+                // one output per input, write by index so the loop vectorizes
+                const std::size_t n = std::min(size(), out.size());
+                auto sink = [dst](std::size_t i, auto&& value){
+                    dst[i] = std::forward<decltype(value)>(value);
+                };
+                _stage.run(0, n, sink);
+                return n;
+            }else{
+                std::size_t count = 0;
+                const std::size_t capacity = out.size();
+                auto sink = [&](std::size_t, auto&& value){
+                    dst[count++] = std::forward<decltype(value)>(value);
+                };
+                // every source element yields at most one value, so a block of at most
+                // capacity - count elements can not overflow out and ends when it is full
+                for(std::size_t begin = 0; begin < size() && count < capacity;){
+                    const std::size_t end = begin + std::min({block_size, capacity - count, size() - begin});
+                    _stage.run(begin, end, sink);
+                    begin = end;
+                }
+                return count;
+            }
+        }
+    };
+
+    /**
+     * Start a pipeline over one or more views of equal size,
+     * the adapters receive one value from every view.
+     */
+    template<typename T, typename C, typename... Views>
+    constexpr auto from(memory_view<T, C> first, Views... rest){
+        if(!((rest.size() == first.size()) && ...))
+            impl::throw_out_of_range("memory_view::from");
+        using stage = impl::source_stage<memory_view<T, C>, Views...>;
+        return pipeline<stage>(stage(first, rest...));
+    }
+}
+
+#endif /* MEMORY_VIEW_PIPELINE_HPP */
@@ -0,0 +1,325 @@
+/**
+ * @file   memory_view/include/memory_view/quantize.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  int8 and 4 bit quantization of float views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_QUANTIZE_HPP
+#define MEMORY_VIEW_QUANTIZE_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) */
+
+namespace memory_view{
+    /**
+     * Affine quantization of one block: x = (q - zero_point) * scale.
+     */
+    struct quantization_params{
+        float        scale;
+        std::int32_t zero_point;
+    };
+
+    namespace impl{
+        inline std::size_t block_count(std::size_t n, std::size_t block_size)noexcept{
+            return (n + block_size - 1) / block_size;
+        }
+
+        // params mapping [lo, hi] onto [qmin, qmax], symmetric ranges keep zero at the center
+        inline quantization_params choose_params(const float* x, std::size_t n, bool symmetric,
+                                                 std::int32_t qmin, std::int32_t qmax)noexcept{
+            float lo = 0.0f;
+            float hi = 0.0f;
+            for(std::size_t i = 0; i < n; i++){
+                lo = std::min(lo, x[i]);
+                hi = std::max(hi, x[i]);
+            }
+            if(symmetric){
+                const std::int32_t center = (qmin + qmax + 1) / 2;
+                const float amax = std::max(-lo, hi);
+                const auto steps = static_cast<float>(std::min(qmax - center, center - qmin));
+                return {amax == 0.0f ? 1.0f : amax / steps, center};
+            }
+            if(hi == lo)
+                return {1.0f, 0};
+            const float scale = (hi - lo) / static_cast<float>(qmax - qmin);
+            const auto zero_point = static_cast<std::int32_t>(std::nearbyint(static_cast<float>(qmin) - lo / scale));
+            return {scale, std::clamp(zero_point, qmin, qmax)};
+        }
+
+        inline std::int32_t quantize_value(float x, float inv_scale, std::int32_t zero_point,
+                                           std::int32_t qmin, std::int32_t qmax)noexcept{
+            const auto q = static_cast<std::int32_t>(std::nearbyint(x * inv_scale)) + zero_point;
+            return std::clamp(q, qmin, qmax);
+        }
+
+        inline void quantize_block(const float* x, std::size_t n, quantization_params p, std::int8_t* q)noexcept{
+            const float inv_scale = 1.0f / p.scale;
+            std::size_t i = 0;
+#if defined(__AVX2__)
+            // round to nearest even like nearbyint, saturate while packing
+            const __m256 vinv = _mm256_set1_ps(inv_scale);
+            const __m256i vzp = _mm256_set1_epi32(p.zero_point);
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+            for(; i + 32 <= n; i += 32){
+                const __m256i a = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(x + i +  0), vinv)), vzp);
+                const __m256i b = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(x + i +  8), vinv)), vzp);
+                const __m256i c = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(x + i + 16), vinv)), vzp);
+                const __m256i d = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(x + i + 24), vinv)), vzp);
+                const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(q + i), _mm256_permutevar8x32_epi32(packed, order));
+            }
+#endif /* defined(__AVX2__) */
+            for(; i < n; i++)
+                q[i] = static_cast<std::int8_t>(quantize_value(x[i], inv_scale, p.zero_point, -128, 127));
+        }
+
+        // elements after which the 32 bit SIMD lanes are added to the 64 bit sum, before they can overflow
+        inline constexpr std::size_t dot_chunk = std::size_t{1} << 19;
+
+        inline std::int64_t dot_int8(const std::int8_t* a, const std::int8_t* b, std::size_t n)noexcept{
+            std::size_t i = 0;
+            std::int64_t sum = 0;
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+            // (a + 128) is unsigned, sum((a + 128) * b) - sum(128 * b) is exact
+            const __m512i bias = _mm512_set1_epi8(-128);
+            while(i + 64 <= n){
+                const std::size_t end = std::min(n, i + dot_chunk);
+                __m512i acc = _mm512_setzero_si512();
+                __m512i correction = _mm512_setzero_si512();
+                for(; i + 64 <= end; i += 64){
+                    const __m512i va = _mm512_xor_si512(_mm512_loadu_si512(a + i), bias);
+                    const __m512i vb = _mm512_loadu_si512(b + i);
+                    acc = _mm512_dpbusd_epi32(acc, va, vb);
+                    correction = _mm512_dpbusd_epi32(correction, bias, vb);
+                }
+                alignas(64) std::int32_t lanes[16];
+                _mm512_store_si512(lanes, _mm512_sub_epi32(acc, correction));
+                for(std::int32_t lane : lanes)
+                    sum += lane;
+            }
+#elif defined(__AVX2__)
+            // widen to 16 bit, madd sums pairs into 32 bit without saturation
+            while(i + 32 <= n){
+                const std::size_t end = std::min(n, i + dot_chunk);
+                __m256i acc = _mm256_setzero_si256();
+                for(; i + 32 <= end; i += 32){
+                    const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                    const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                    const __m256i alo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(va));
+                    const __m256i ahi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(va, 1));
+                    const __m256i blo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(vb));
+                    const __m256i bhi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(vb, 1));
+                    acc = _mm256_add_epi32(acc, _mm256_madd_epi16(alo, blo));
+                    acc = _mm256_add_epi32(acc, _mm256_madd_epi16(ahi, bhi));
+                }
+                alignas(32) std::int32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+                for(std::int32_t lane : lanes)
+                    sum += lane;
+            }
+#endif /* defined(__AVX512VNNI__) && defined(__AVX512BW__) */
+            for(; i < n; i++)
+                sum += static_cast<std::int32_t>(a[i]) * static_cast<std::int32_t>(b[i]);
+            return sum;
+        }
+
+        inline std::int64_t sum_int8(const std::int8_t* a, std::size_t n)noexcept{
+            std::int64_t sum = 0;
+            for(std::size_t i = 0; i < n; i++)
+                sum += a[i];
+            return sum;
+        }
+
+        // unpack 4 bit values (low nibble first) into signed bytes
+        inline void unpack_4bit(const std::uint8_t* packed, std::size_t n, std::int8_t* q)noexcept{
+            for(std::size_t i = 0; i < n / 2; i++){
+                q[2 * i]     = static_cast<std::int8_t>(packed[i] & 0x0f);
+                q[2 * i + 1] = static_cast<std::int8_t>(packed[i] >> 4);
+            }
+        }
+
+        inline void check_blocks(std::size_t n, std::size_t block_size, std::size_t params, const char* what){
+            if(block_size == 0 || params != block_count(n, block_size))
+                impl::throw_out_of_range(what);
+        }
+    }
+
+    /**
+     * Quantize in to int8 in blocks of block_size elements (per tensor with block_size >= in.size()),
+     * params receives one entry per block.
+     * Symmetric blocks use [-127, 127] and zero_point 0, asymmetric blocks [-128, 127].
+     */
+    inline void quantize(memory_view<const float> in, memory_view<std::int8_t> out,
+                         memory_view<quantization_params> params, std::size_t block_size, bool symmetric = true){
+        if(in.size() != out.size())
+            impl::throw_out_of_range("memory_view::quantize");
+        impl::check_blocks(in.size(), block_size, params.size(), "memory_view::quantize");
+
+        for(std::size_t b = 0; b < params.size(); b++){
+            const std::size_t begin = b * block_size;
+            const std::size_t n = std::min(block_size, in.size() - begin);
+            params[b] = symmetric ? impl::choose_params(in.data() + begin, n, true, -127, 127)
+                                  : impl::choose_params(in.data() + begin, n, false, -128, 127);
+            impl::quantize_block(in.data() + begin, n, params[b], out.data() + begin);
+        }
+    }
+
+    inline void dequantize(memory_view<const std::int8_t> in, memory_view<const quantization_params> params,
+                           std::size_t block_size, memory_view<float> out){
+        if(in.size() != out.size())
+            impl::throw_out_of_range("memory_view::dequantize");
+        impl::check_blocks(in.size(), block_size, params.size(), "memory_view::dequantize");
+
+        for(std::size_t b = 0; b < params.size(); b++){
+            const std::size_t begin = b * block_size;
+            const std::size_t n = std::min(block_size, in.size() - begin);
+            const float scale = params[b].scale;
+            const auto zero_point = static_cast<float>(params[b].zero_point);
+            for(std::size_t i = begin; i < begin + n; i++)
+                out[i] = (static_cast<float>(in[i]) - zero_point) * scale;
+        }
+    }
+
+    /**
+     * Quantize in to 4 bit values packed two per byte (low nibble first) in blocks
+     * of block_size elements, in.size() and block_size must be even.
+     * The nibbles are unsigned, symmetric blocks use [1, 15] with zero_point 8,
+     * asymmetric blocks [0, 15].
+     */
+    inline void quantize_4bit(memory_view<const float> in, memory_view<std::uint8_t> out,
+                              memory_view<quantization_params> params, std::size_t block_size, bool symmetric = true){
+        if(in.size() % 2 != 0 || block_size % 2 != 0 || out.size() != in.size() / 2)
+            impl::throw_out_of_range("memory_view::quantize_4bit");
+        impl::check_blocks(in.size(), block_size, params.size(), "memory_view::quantize_4bit");
+
+        for(std::size_t b = 0; b < params.size(); b++){
+            const std::size_t begin = b * block_size;
+            const std::size_t n = std::min(block_size, in.size() - begin);
+            const quantization_params p = impl::choose_params(in.data() + begin, n, symmetric, symmetric ? 1 : 0, 15);
+            params[b] = p;
+            const float inv_scale = 1.0f / p.scale;
+            for(std::size_t i = begin; i < begin + n; i += 2){
+                const std::int32_t lo = impl::quantize_value(in[i], inv_scale, p.zero_point, 0, 15);
+                const std::int32_t hi = impl::quantize_value(in[i + 1], inv_scale, p.zero_point, 0, 15);
+                out[i / 2] = static_cast<std::uint8_t>(lo | (hi << 4));
+            }
+        }
+    }
+
+    inline void dequantize_4bit(memory_view<const std::uint8_t> in, memory_view<const quantization_params> params,
+                                std::size_t block_size, memory_view<float> out){
+        if(block_size % 2 != 0 || out.size() != in.size() * 2)
+            impl::throw_out_of_range("memory_view::dequantize_4bit");
+        impl::check_blocks(out.size(), block_size, params.size(), "memory_view::dequantize_4bit");
+
+        for(std::size_t i = 0; i < in.size(); i++){
+            const quantization_params& p = params[2 * i / block_size];
+            const auto zero_point = static_cast<float>(p.zero_point);
+            out[2 * i]     = (static_cast<float>(in[i] & 0x0f) - zero_point) * p.scale;
+            out[2 * i + 1] = (static_cast<float>(in[i] >> 4) - zero_point) * p.scale;
+        }
+    }
+
+    // exact dot product of two int8 views, AVX-512 VNNI or AVX2 when available
+    inline std::int64_t dot(memory_view<const std::int8_t> a, memory_view<const std::int8_t> b){
+        if(a.size() != b.size())
+            impl::throw_out_of_range("memory_view::dot");
+        return impl::dot_int8(a.data(), b.data(), a.size());
+    }
+
+    /**
+     * Dot product of the float values represented by two block quantized int8 views,
+     * computed on the quantized values with one integer dot product per block.
+     */
+    inline float dot(memory_view<const std::int8_t> a, memory_view<const quantization_params> pa,
+                     memory_view<const std::int8_t> b, memory_view<const quantization_params> pb,
+                     std::size_t block_size){
+        if(a.size() != b.size() || pa.size() != pb.size())
+            impl::throw_out_of_range("memory_view::dot");
+        impl::check_blocks(a.size(), block_size, pa.size(), "memory_view::dot");
+
+        float sum = 0.0f;
+        for(std::size_t blk = 0; blk < pa.size(); blk++){
+            const std::size_t begin = blk * block_size;
+            const std::size_t n = std::min(block_size, a.size() - begin);
+            const std::int8_t* qa = a.data() + begin;
+            const std::int8_t* qb = b.data() + begin;
+            const std::int32_t za = pa[blk].zero_point;
+            const std::int32_t zb = pb[blk].zero_point;
+
+            // sum((qa - za) * (qb - zb)) expanded
+            std::int64_t acc = impl::dot_int8(qa, qb, n);
+            if(za != 0)
+                acc -= za * impl::sum_int8(qb, n);
+            if(zb != 0)
+                acc -= zb * impl::sum_int8(qa, n);
+            acc += static_cast<std::int64_t>(za) * zb * static_cast<std::int64_t>(n);
+            sum += static_cast<float>(acc) * pa[blk].scale * pb[blk].scale;
+        }
+        return sum;
+    }
+
+    /**
+     * Dot product of two block quantized 4 bit views, every block is unpacked into
+     * bytes on the stack and multiplied with the int8 kernel, block_size must be at most 256.
+     */
+    inline float dot_4bit(memory_view<const std::uint8_t> a, memory_view<const quantization_params> pa,
+                          memory_view<const std::uint8_t> b, memory_view<const quantization_params> pb,
+                          std::size_t block_size){
+        constexpr std::size_t max_block = 256;
+        if(a.size() != b.size() || pa.size() != pb.size() || block_size > max_block || block_size % 2 != 0)
+            impl::throw_out_of_range("memory_view::dot_4bit");
+        impl::check_blocks(a.size() * 2, block_size, pa.size(), "memory_view::dot_4bit");
+
+        std::int8_t qa[max_block];
+        std::int8_t qb[max_block];
+        float sum = 0.0f;
+        for(std::size_t blk = 0; blk < pa.size(); blk++){
+            const std::size_t begin = blk * block_size;
+            const std::size_t n = std::min(block_size, a.size() * 2 - begin);
+            impl::unpack_4bit(a.data() + begin / 2, n, qa);
+            impl::unpack_4bit(b.data() + begin / 2, n, qb);
+            const std::int32_t za = pa[blk].zero_point;
+            const std::int32_t zb = pb[blk].zero_point;
+            const std::int64_t acc = impl::dot_int8(qa, qb, n)
+                - za * impl::sum_int8(qb, n) - zb * impl::sum_int8(qa, n)
+                + za * zb * static_cast<std::int64_t>(n);
+            sum += static_cast<float>(acc) * pa[blk].scale * pb[blk].scale;
+        }
+        return sum;
+    }
+}
+
+#endif /* MEMORY_VIEW_QUANTIZE_HPP */
@@ -0,0 +1,283 @@
+/**
+ * @file   memory_view/include/memory_view/resize.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  separable image resampling between matrix views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_RESIZE_HPP
+#define MEMORY_VIEW_RESIZE_HPP
+
+#include "../memory_view.hpp"
+#include "matrix_view.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace memory_view{
+    enum class resize_filter{
+        bilinear,
+        area,
+        lanczos3,
+    };
+
+    namespace impl{
+        // fractional bits of the fixed point weights used for 8 bit data
+        inline constexpr int resize_precision = 14;
+
+        // columns per strip of the vertical pass, keeps the source rows of one strip in L1
+        inline constexpr std::size_t resize_strip = 1024;
+
+        /**
+         * Weights of one axis, output i is the sum over k < taps of
+         * weights[i * taps + k] * input[start[i] + k].
+         */
+        struct resize_weights{
+            std::size_t                taps;
+            std::vector<std::size_t>   start;
+            std::vector<float>         weights;
+            std::vector<std::int32_t>  fixed;
+        };
+
+        inline double sinc(double x)noexcept{
+            if(x == 0.0)
+                return 1.0;
+            x *= 3.14159265358979323846;
+            return std::sin(x) / x;
+        }
+
+        inline double filter_value(resize_filter filter, double x)noexcept{
+            x = std::fabs(x);
+            switch(filter){
+            case resize_filter::bilinear:
+                return x < 1.0 ? 1.0 - x : 0.0;
+            case resize_filter::lanczos3:
+                return x < 3.0 ? sinc(x) * sinc(x / 3.0) : 0.0;
+            case resize_filter::area:
+            default:
+                return x <= 0.5 ? 1.0 : 0.0;
+            }
+        }
+
+        inline double filter_radius(resize_filter filter)noexcept{
+            switch(filter){
+            case resize_filter::bilinear: return 1.0;
+            case resize_filter::lanczos3: return 3.0;
+            case resize_filter::area:
+            default:                      return 0.5;
+            }
+        }
+
+        inline resize_weights make_resize_weights(std::size_t in, std::size_t out, resize_filter filter){
+            const double scale = static_cast<double>(in) / static_cast<double>(out);
+            // downscaling widens the filter so every input sample contributes
+            const double stretch = std::max(scale, 1.0);
+            const double support = filter_radius(filter) * stretch;
+
+            resize_weights w;
+            w.taps = std::min(in, static_cast<std::size_t>(std::ceil(support)) * 2 + 1);
+            w.start.resize(out);
+            w.weights.assign(out * w.taps, 0.0f);
+            w.fixed.assign(out * w.taps, 0);
+
+            std::vector<double> tmp(w.taps);
+            for(std::size_t i = 0; i < out; i++){
+                const double center = (static_cast<double>(i) + 0.5) * scale;
+                const auto lo = static_cast<std::ptrdiff_t>(std::floor(center - support));
+                const std::size_t first = static_cast<std::size_t>(std::max<std::ptrdiff_t>(lo, 0));
+                const std::size_t start = std::min(first, in - w.taps);
+                w.start[i] = start;
+
+                double sum = 0.0;
+                for(std::size_t k = 0; k < w.taps; k++){
+                    const double x = static_cast<double>(start + k) + 0.5;
+                    double v;
+                    if(filter == resize_filter::area){
+                        // exact overlap of the input pixel with the output pixel footprint
+                        const double left  = std::max(x - 0.5, center - 0.5 * scale);
+                        const double right = std::min(x + 0.5, center + 0.5 * scale);
+                        v = std::max(right - left, 0.0);
+                    }else{
+                        v = filter_value(filter, (x - center) / stretch);
+                    }
+                    tmp[k] = v;
+                    sum += v;
+                }
+                if(sum == 0.0){
+                    // footprint between two samples, use the nearest one
+                    const auto nearest = static_cast<std::size_t>(std::clamp<double>(std::floor(center), 0.0, static_cast<double>(in - 1)));
+                    tmp.assign(w.taps, 0.0);
+                    tmp[nearest - start] = 1.0;
+                    sum = 1.0;
+                }
+
+                std::int32_t fixed_sum = 0;
+                std::size_t largest = 0;
+                for(std::size_t k = 0; k < w.taps; k++){
+                    const double v = tmp[k] / sum;
+                    w.weights[i * w.taps + k] = static_cast<float>(v);
+                    w.fixed[i * w.taps + k] = static_cast<std::int32_t>(std::lround(v * (1 << resize_precision)));
+                    fixed_sum += w.fixed[i * w.taps + k];
+                    if(std::fabs(tmp[k]) > std::fabs(tmp[largest]))
+                        largest = k;
+                }
+                // the fixed point weights must sum to exactly one
+                w.fixed[i * w.taps + largest] += (1 << resize_precision) - fixed_sum;
+            }
+            return w;
+        }
+
+        // the 8 bit horizontal pass keeps its sums unrounded and unclamped in 32 bit, scaled by
+        // 1 << resize_precision, so the vertical pass rounds once from 64 bit sums scaled twice
+        template<typename T>
+        using resize_accumulator = std::conditional_t<std::is_same_v<T, float>, float, std::int32_t>;
+        template<typename T>
+        using resize_wide_accumulator = std::conditional_t<std::is_same_v<T, float>, float, std::int64_t>;
+
+        inline float resize_store(float acc, float)noexcept{
+            return acc;
+        }
+        inline std::uint8_t resize_store(std::int64_t acc, std::uint8_t)noexcept{
+            constexpr int shift = 2 * resize_precision;
+            const std::int64_t v = (acc + (std::int64_t{1} << (shift - 1))) >> shift;
+            return static_cast<std::uint8_t>(std::clamp<std::int64_t>(v, 0, 255));
+        }
+
+        template<typename T>
+        const resize_accumulator<T>* resize_weight_data(const resize_weights& w)noexcept{
+            if constexpr(std::is_same_v<T, float>)
+                return w.weights.data();
+            else
+                return w.fixed.data();
+        }
+
+        template<typename T>
+        void resize_horizontal(matrix_view<const T> src, matrix_view<resize_accumulator<T>> dst, const resize_weights& w,
+                               std::size_t channels, std::size_t begin, std::size_t end){
+            using acc_t = resize_accumulator<T>;
+            const acc_t* weights = resize_weight_data<T>(w);
+            const std::size_t out_width = dst.cols() / channels;
+            for(std::size_t y = begin; y < end; y++){
+                const T* in = src.row(y).data();
+                acc_t* out = dst.row(y).data();
+                for(std::size_t x = 0; x < out_width; x++){
+                    const acc_t* wx = weights + x * w.taps;
+                    const T* px = in + w.start[x] * channels;
+                    for(std::size_t c = 0; c < channels; c++){
+                        acc_t acc = 0;
+                        for(std::size_t k = 0; k < w.taps; k++)
+                            acc += wx[k] * static_cast<acc_t>(px[k * channels + c]);
+                        out[x * channels + c] = acc;
+                    }
+                }
+            }
+        }
+
+        template<typename T>
+        void resize_vertical(matrix_view<const resize_accumulator<T>> src, matrix_view<T> dst, const resize_weights& w,
+                             std::size_t begin, std::size_t end){
+            using acc_t  = resize_accumulator<T>;
+            using wide_t = resize_wide_accumulator<T>;
+            const acc_t* weights = resize_weight_data<T>(w);
+            wide_t acc[resize_strip];
+            for(std::size_t y = begin; y < end; y++){
+                const acc_t* wy = weights + y * w.taps;
+                T* out = dst.row(y).data();
+                for(std::size_t x0 = 0; x0 < dst.cols(); x0 += resize_strip){
+                    const std::size_t n = std::min(resize_strip, dst.cols() - x0);
+                    std::fill(acc, acc + n, wide_t{0});
+                    // whole rows of the strip, the inner loop is contiguous and vectorizes
+                    for(std::size_t k = 0; k < w.taps; k++){
+                        const acc_t* in = src.row(w.start[y] + k).data() + x0;
+                        const wide_t weight = wy[k];
+                        for(std::size_t x = 0; x < n; x++)
+                            acc[x] += weight * static_cast<wide_t>(in[x]);
+                    }
+                    for(std::size_t x = 0; x < n; x++)
+                        out[x0 + x] = resize_store(acc[x], T{});
+                }
+            }
+        }
+
+        template<typename T>
+        void resize(matrix_view<const T> src, matrix_view<T> dst, resize_filter filter,
+                    std::size_t channels, std::size_t threads){
+            if(channels == 0 || src.cols() % channels != 0 || dst.cols() % channels != 0 ||
+               (src.empty() != dst.empty()))
+                impl::throw_out_of_range("memory_view::resize");
+            if(dst.empty())
+                return;
+
+            const resize_weights wx = make_resize_weights(src.cols() / channels, dst.cols() / channels, filter);
+            const resize_weights wy = make_resize_weights(src.rows(), dst.rows(), filter);
+
+            // only the source rows which contribute to an output row are resampled horizontally
+            const std::size_t first = wy.start.front();
+            const std::size_t last  = wy.start.back() + wy.taps;
+            std::vector<resize_accumulator<T>> tmp((last - first) * dst.cols());
+            const matrix_view<resize_accumulator<T>> rows(tmp.data(), last - first, dst.cols());
+
+            parallel_for(last - first, threads, [&](std::size_t begin, std::size_t end){
+                resize_horizontal<T>(src.row_range(first, last - first), rows, wx, channels, begin, end);
+            }, 16);
+
+            resize_weights shifted = wy;
+            for(auto& start : shifted.start)
+                start -= first;
+            parallel_for(dst.rows(), threads, [&](std::size_t begin, std::size_t end){
+                resize_vertical<T>(rows, dst, shifted, begin, end);
+            }, 16);
+        }
+    }
+
+    /**
+     * Resample src into dst with a separable filter, the columns hold
+     * interleaved pixels of the given number of channels.
+     *
+     * Downscaling widens the filter so all source pixels contribute,
+     * area computes the exact pixel overlap. The horizontal pass runs
+     * first, both passes split their rows over threads.
+     */
+    inline void resize(matrix_view<const float> src, matrix_view<float> dst,
+                       resize_filter filter = resize_filter::bilinear,
+                       std::size_t channels = 1, std::size_t threads = 1){
+        impl::resize<float>(src, dst, filter, channels, threads);
+    }
+
+    // 8 bit version, uses 14 bit fixed point weights, the intermediate rows are unrounded 32 bit sums
+    inline void resize(matrix_view<const std::uint8_t> src, matrix_view<std::uint8_t> dst,
+                       resize_filter filter = resize_filter::bilinear,
+                       std::size_t channels = 1, std::size_t threads = 1){
+        impl::resize<std::uint8_t>(src, dst, filter, channels, threads);
+    }
+}
+
+#endif /* MEMORY_VIEW_RESIZE_HPP */
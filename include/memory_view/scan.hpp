@@ -0,0 +1,237 @@
+/**
+ * @file   memory_view/include/memory_view/scan.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  prefix sums and segmented prefix sums over views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_SCAN_HPP
+#define MEMORY_VIEW_SCAN_HPP
+
+#include "../memory_view.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__SSE2__) */
+
+namespace memory_view{
+    namespace impl{
+        // elements per chunk below which the parallel scan is not worth starting threads
+        inline constexpr std::size_t scan_grain = std::size_t{1} << 15;
+
+#if defined(__SSE2__)
+        // 4 lanes of T, with the byte shifts needed for the in register scan
+        template<typename T>
+        struct scan_vector;
+
+        template<>
+        struct scan_vector<float>{
+            using type = __m128;
+            static type load(const float* p)noexcept{ return _mm_loadu_ps(p); }
+            static void store(float* p, type v)noexcept{ _mm_storeu_ps(p, v); }
+            static type set1(float x)noexcept{ return _mm_set1_ps(x); }
+            static type add(type a, type b)noexcept{ return _mm_add_ps(a, b); }
+            template<int Bytes>
+            static type shift(type v)noexcept{ return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), Bytes)); }
+            static type last(type v)noexcept{ return _mm_shuffle_ps(v, v, 0xFF); }
+        };
+
+        template<typename T>
+        struct scan_vector_epi32{
+            using type = __m128i;
+            static type load(const T* p)noexcept{ return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store(T* p, type v)noexcept{ _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static type set1(T x)noexcept{ return _mm_set1_epi32(static_cast<std::int32_t>(x)); }
+            static type add(type a, type b)noexcept{ return _mm_add_epi32(a, b); }
+            template<int Bytes>
+            static type shift(type v)noexcept{ return _mm_slli_si128(v, Bytes); }
+            static type last(type v)noexcept{ return _mm_shuffle_epi32(v, 0xFF); }
+        };
+
+        template<>
+        struct scan_vector<std::int32_t> : scan_vector_epi32<std::int32_t>{};
+        template<>
+        struct scan_vector<std::uint32_t> : scan_vector_epi32<std::uint32_t>{};
+
+        template<typename T>
+        inline constexpr bool has_scan_vector = std::is_same_v<T, float> || std::is_same_v<T, std::int32_t> ||
+                                                std::is_same_v<T, std::uint32_t>;
+#endif /* defined(__SSE2__) */
+
+        /**
+         * Scan n elements of in into out starting with carry, returns carry plus the sum of in.
+         * in and out may be the same pointer.
+         *
+         * 4 byte types are scanned 4 at a time: two shifted adds scan the vector,
+         * the carry is added and the last lane becomes the next carry.
+         */
+        template<bool Inclusive, typename T, typename U>
+        U scan(const T* in, U* out, std::size_t n, U carry){
+            std::size_t i = 0;
+#if defined(__SSE2__)
+            if constexpr(std::is_same_v<std::remove_const_t<T>, U> && has_scan_vector<U>){
+                using vector = scan_vector<U>;
+                auto c = vector::set1(carry);
+                for(; i + 4 <= n; i += 4){
+                    auto x = vector::load(in + i);
+                    x = vector::add(x, vector::template shift<4>(x));
+                    x = vector::add(x, vector::template shift<8>(x));
+                    if constexpr(Inclusive)
+                        vector::store(out + i, vector::add(c, x));
+                    else
+                        vector::store(out + i, vector::add(c, vector::template shift<4>(x)));
+                    c = vector::add(c, vector::last(x));
+                }
+                U lanes[4];
+                vector::store(lanes, c);
+                carry = lanes[0];
+            }
+#endif /* defined(__SSE2__) */
+            for(; i < n; i++){
+                const U x = in[i];
+                if constexpr(Inclusive){
+                    carry  = carry + x;
+                    out[i] = carry;
+                }else{
+                    out[i] = carry;
+                    carry  = carry + x;
+                }
+            }
+            return carry;
+        }
+
+        /**
+         * Reduce then scan: every chunk is summed in parallel, the chunk sums are
+         * scanned serially and every chunk is scanned in parallel starting with its offset.
+         * The input is read twice and the output written once.
+         */
+        template<bool Inclusive, typename T, typename U>
+        U parallel_scan(const T* in, U* out, std::size_t n, U init, std::size_t threads){
+            const std::size_t chunks = std::min(thread_count(threads), std::max<std::size_t>(1, n / scan_grain));
+            if(chunks <= 1)
+                return scan<Inclusive>(in, out, n, init);
+
+            const auto chunk_begin = [&](std::size_t c){
+                return n / chunks * c + std::min(c, n % chunks);
+            };
+            std::vector<U> offsets(chunks + 1);
+            offsets[0] = init;
+            parallel_for(chunks - 1, threads, [&](std::size_t begin, std::size_t end){
+                for(std::size_t c = begin; c < end; c++){
+                    U sum{};
+                    const T* p = in + chunk_begin(c);
+                    const std::size_t size = chunk_begin(c + 1) - chunk_begin(c);
+                    for(std::size_t i = 0; i < size; i++)
+                        sum = sum + p[i];
+                    offsets[c + 1] = sum;
+                }
+            });
+            for(std::size_t c = 1; c < chunks; c++)
+                offsets[c] = offsets[c - 1] + offsets[c];
+
+            U total{};
+            parallel_for(chunks, threads, [&](std::size_t begin, std::size_t end){
+                for(std::size_t c = begin; c < end; c++){
+                    const std::size_t first = chunk_begin(c);
+                    const U last = scan<Inclusive>(in + first, out + first, chunk_begin(c + 1) - first, offsets[c]);
+                    if(c == chunks - 1)
+                        total = last;
+                }
+            });
+            return total;
+        }
+
+        template<typename T, typename C1, typename U, typename C2>
+        void check_scan_views(memory_view<T, C1> in, memory_view<U, C2> out, const char* s){
+            if(in.size() != out.size())
+                throw_out_of_range(s);
+        }
+    }
+
+    /**
+     * out[i] = in[0] + ... + in[i], returns the sum of in.
+     * in and out may be the same view, with threads > 1 large views are scanned in parallel.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    U inclusive_scan(memory_view<T, C1> in, memory_view<U, C2> out, std::size_t threads = 1){
+        impl::check_scan_views(in, out, "memory_view::inclusive_scan");
+        return impl::parallel_scan<true>(in.data(), out.data(), in.size(), U{}, threads);
+    }
+
+    /**
+     * out[i] = init + in[0] + ... + in[i - 1], returns init plus the sum of in
+     * (e.g. the lengths of variable length values into their offsets and the total size).
+     * in and out may be the same view, with threads > 1 large views are scanned in parallel.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    U exclusive_scan(memory_view<T, C1> in, memory_view<U, C2> out, U init = U{}, std::size_t threads = 1){
+        impl::check_scan_views(in, out, "memory_view::exclusive_scan");
+        return impl::parallel_scan<false>(in.data(), out.data(), in.size(), init, threads);
+    }
+
+    /**
+     * Inclusive scan which restarts at every i where flags[i] is set,
+     * in, flags and out have the same size and in and out may be the same view.
+     */
+    template<typename T, typename C1, typename F, typename C2, typename U, typename C3>
+    void segmented_inclusive_scan(memory_view<T, C1> in, memory_view<F, C2> flags, memory_view<U, C3> out){
+        impl::check_scan_views(in, out, "memory_view::segmented_inclusive_scan");
+        impl::check_scan_views(in, flags, "memory_view::segmented_inclusive_scan");
+        U carry{};
+        for(std::size_t i = 0; i < in.size(); i++){
+            const U x = in.data()[i];
+            carry = flags.data()[i] ? x : carry + x;
+            out.data()[i] = carry;
+        }
+    }
+
+    /**
+     * Exclusive scan which restarts with init at every i where flags[i] is set,
+     * in, flags and out have the same size and in and out may be the same view.
+     */
+    template<typename T, typename C1, typename F, typename C2, typename U, typename C3>
+    void segmented_exclusive_scan(memory_view<T, C1> in, memory_view<F, C2> flags, memory_view<U, C3> out, U init = U{}){
+        impl::check_scan_views(in, out, "memory_view::segmented_exclusive_scan");
+        impl::check_scan_views(in, flags, "memory_view::segmented_exclusive_scan");
+        U carry = init;
+        for(std::size_t i = 0; i < in.size(); i++){
+            const U x = in.data()[i];
+            if(flags.data()[i])
+                carry = init;
+            out.data()[i] = carry;
+            carry = carry + x;
+        }
+    }
+}
+
+#endif /* MEMORY_VIEW_SCAN_HPP */
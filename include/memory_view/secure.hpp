@@ -0,0 +1,126 @@
+/**
+ * @file   memory_view/include/memory_view/secure.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  secure zeroing and constant time comparison of views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_SECURE_HPP
+#define MEMORY_VIEW_SECURE_HPP
+
+#include "../memory_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__AVX2__) */
+
+namespace memory_view{
+    namespace impl{
+        // keep the compiler from treating the stores to p as dead
+        inline void compiler_barrier(void* p)noexcept{
+#if defined(__GNUC__) || defined(__clang__)
+            __asm__ __volatile__("" : : "r"(p) : "memory");
+#else
+            volatile unsigned char* v = static_cast<unsigned char*>(p);
+            (void)*v;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+        }
+    }
+
+    /**
+     * Overwrite the memory of view with zeros, the stores are not
+     * removed even if view is not read afterwards (e.g. before a free).
+     */
+    template<typename T, typename C>
+    void secure_zero(memory_view<T, C> view)noexcept{
+        static_assert(std::is_trivially_copyable_v<T>, "secure_zero requires a trivially copyable type");
+        static_assert(!std::is_const_v<T>, "secure_zero requires a mutable view");
+        if(view.empty())
+            return;
+        std::memset(view.data(), 0, view.size() * sizeof(T));
+        impl::compiler_barrier(view.data());
+    }
+
+    /**
+     * Compare the bytes of a and b in a time that only depends on their size.
+     *
+     * Unlike operator== this does not stop at the first difference,
+     * all differences are OR'ed together and only tested at the end.
+     */
+    template<typename T, typename C1, typename U, typename C2>
+    bool constant_time_equal(memory_view<T, C1> a, memory_view<U, C2> b)noexcept{
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_copyable_v<U>,
+                      "constant_time_equal requires trivially copyable types");
+        const std::size_t n = a.size() * sizeof(T);
+        if(n != b.size() * sizeof(U))
+            return false;
+
+        const unsigned char* pa = reinterpret_cast<const unsigned char*>(a.data());
+        const unsigned char* pb = reinterpret_cast<const unsigned char*>(b.data());
+        std::size_t i = 0;
+        std::uint64_t diff = 0;
+
+#if defined(__AVX2__)
+        __m256i acc = _mm256_setzero_si256();
+        for(; i + 32 <= n; i += 32)
+            acc = _mm256_or_si256(acc, _mm256_xor_si256(
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa + i)),
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + i))));
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        diff |= lanes[0] | lanes[1] | lanes[2] | lanes[3];
+#elif defined(__SSE2__)
+        __m128i acc = _mm_setzero_si128();
+        for(; i + 16 <= n; i += 16)
+            acc = _mm_or_si128(acc, _mm_xor_si128(
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + i)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + i))));
+        alignas(16) std::uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        diff |= lanes[0] | lanes[1];
+#endif /* defined(__AVX2__) */
+
+        for(; i + 8 <= n; i += 8){
+            std::uint64_t x, y;
+            std::memcpy(&x, pa + i, 8);
+            std::memcpy(&y, pb + i, 8);
+            diff |= x ^ y;
+        }
+        for(; i < n; i++)
+            diff |= static_cast<std::uint64_t>(pa[i] ^ pb[i]);
+
+        return diff == 0;
+    }
+}
+
+#endif /* MEMORY_VIEW_SECURE_HPP */
@@ -0,0 +1,239 @@
+/**
+ * @file   memory_view/include/memory_view/similarity_search.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  exhaustive top-k search over a matrix of embeddings
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_SIMILARITY_SEARCH_HPP
+#define MEMORY_VIEW_SIMILARITY_SEARCH_HPP
+
+#include "../memory_view.hpp"
+#include "gemm.hpp"
+#include "matrix_view.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) && defined(__FMA__) */
+
+namespace memory_view{
+    enum class metric{
+        l2,            // squared euclidean distance, smaller is better
+        inner_product, // larger is better
+        cosine,        // larger is better
+    };
+
+    namespace impl{
+        // base vectors per block, a block of 128 dimensional vectors fits into L2
+        inline constexpr std::size_t search_base_block = 256;
+        // queries per block, the query block stays in L1
+        inline constexpr std::size_t search_query_block = 16;
+
+        inline float l2_squared(const float* a, const float* b, std::size_t n)noexcept{
+            std::size_t i = 0;
+            float sum = 0.0f;
+#if defined(__AVX2__) && defined(__FMA__)
+            __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+            for(; i + 16 <= n; i += 16){
+                const __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+                const __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8));
+                s0 = _mm256_fmadd_ps(d0, d0, s0);
+                s1 = _mm256_fmadd_ps(d1, d1, s1);
+            }
+            for(; i + 8 <= n; i += 8){
+                const __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+                s0 = _mm256_fmadd_ps(d0, d0, s0);
+            }
+            const __m256 s = _mm256_add_ps(s0, s1);
+            __m128 h = _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+            h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+            h = _mm_add_ss(h, _mm_movehdup_ps(h));
+            sum = _mm_cvtss_f32(h);
+#else
+            float partial[8] = {};
+            for(; i + 8 <= n; i += 8)
+                for(std::size_t j = 0; j < 8; j++){
+                    const float d = a[i + j] - b[i + j];
+                    partial[j] += d * d;
+                }
+            for(std::size_t j = 0; j < 8; j++)
+                sum += partial[j];
+#endif /* defined(__AVX2__) && defined(__FMA__) */
+            for(; i < n; i++){
+                const float d = a[i] - b[i];
+                sum += d * d;
+            }
+            return sum;
+        }
+
+        /**
+         * Bounded heap of the k best (score, index) pairs, the worst entry is on top.
+         * Scores are stored so that smaller is always better.
+         */
+        class top_k{
+            std::size_t                              _k;
+            std::vector<std::pair<float, std::size_t>> _heap;
+
+        public:
+            explicit top_k(std::size_t k):
+                _k{k}{
+                _heap.reserve(k);
+            }
+
+            float worst()const noexcept{
+                return _heap.size() < _k ? std::numeric_limits<float>::infinity() : _heap.front().first;
+            }
+
+            void push(float score, std::size_t index){
+                if(_heap.size() < _k){
+                    _heap.emplace_back(score, index);
+                    std::push_heap(_heap.begin(), _heap.end());
+                }else if(score < _heap.front().first){
+                    std::pop_heap(_heap.begin(), _heap.end());
+                    _heap.back() = {score, index};
+                    std::push_heap(_heap.begin(), _heap.end());
+                }
+            }
+
+            void merge(const top_k& other){
+                for(const auto& [score, index] : other._heap)
+                    push(score, index);
+            }
+
+            std::vector<std::pair<float, std::size_t>> sorted()const{
+                std::vector<std::pair<float, std::size_t>> result = _heap;
+                std::sort(result.begin(), result.end());
+                return result;
+            }
+        };
+
+        inline float norm(const float* a, std::size_t n)noexcept{
+            return std::sqrt(dot(a, a, n));
+        }
+
+        // the k best base vectors of [begin, end) for every query
+        inline void search_shard(matrix_view<const float> base, matrix_view<const float> queries, metric m,
+                                 std::size_t begin, std::size_t end, std::vector<top_k>& heaps){
+            const std::size_t dim = base.cols();
+            std::vector<float> query_norms(m == metric::cosine ? queries.rows() : 0);
+            for(std::size_t q = 0; q < query_norms.size(); q++)
+                query_norms[q] = norm(queries.row(q).data(), dim);
+            float base_norms[search_base_block];
+
+            for(std::size_t b0 = begin; b0 < end; b0 += search_base_block){
+                const std::size_t nb = std::min(search_base_block, end - b0);
+                if(m == metric::cosine)
+                    for(std::size_t i = 0; i < nb; i++)
+                        base_norms[i] = norm(base.row(b0 + i).data(), dim);
+
+                // the base block is read from memory once and reused for all queries
+                for(std::size_t q0 = 0; q0 < queries.rows(); q0 += search_query_block){
+                    const std::size_t nq = std::min(search_query_block, queries.rows() - q0);
+                    for(std::size_t i = 0; i < nb; i++){
+                        const float* x = base.row(b0 + i).data();
+                        for(std::size_t j = 0; j < nq; j++){
+                            const float* y = queries.row(q0 + j).data();
+                            float score;
+                            switch(m){
+                            case metric::l2:
+                                score = l2_squared(x, y, dim);
+                                break;
+                            case metric::inner_product:
+                                score = -dot(x, y, dim);
+                                break;
+                            case metric::cosine:
+                            default:{
+                                const float denominator = base_norms[i] * query_norms[q0 + j];
+                                score = denominator == 0.0f ? 0.0f : -dot(x, y, dim) / denominator;
+                                break;
+                            }
+                            }
+                            top_k& heap = heaps[q0 + j];
+                            if(score < heap.worst())
+                                heap.push(score, b0 + i);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Exhaustive k nearest neighbour search of every row of queries in the rows of base.
+     *
+     * indices and scores (queries.rows() x k) receive the results best first,
+     * the scores are squared distances for l2 and similarities otherwise.
+     * With less than k base vectors the remaining indices are set to
+     * std::numeric_limits<std::size_t>::max().
+     *
+     * The base rows are sharded over threads, every shard is processed in blocks
+     * which are compared against blocks of queries while they are in cache.
+     */
+    inline void search(matrix_view<const float> base, matrix_view<const float> queries, std::size_t k, metric m,
+                       matrix_view<std::size_t> indices, matrix_view<float> scores, std::size_t threads = 1){
+        if(base.cols() != queries.cols() ||
+           indices.rows() != queries.rows() || indices.cols() != k ||
+           scores.rows() != queries.rows() || scores.cols() != k)
+            impl::throw_out_of_range("memory_view::search");
+        if(k == 0)
+            return;
+
+        std::vector<impl::top_k> heaps(queries.rows(), impl::top_k(k));
+        std::mutex merge_mutex;
+        parallel_for(base.rows(), threads, [&](std::size_t begin, std::size_t end){
+            std::vector<impl::top_k> local(queries.rows(), impl::top_k(k));
+            impl::search_shard(base, queries, m, begin, end, local);
+            std::lock_guard<std::mutex> lock(merge_mutex);
+            for(std::size_t q = 0; q < queries.rows(); q++)
+                heaps[q].merge(local[q]);
+        }, impl::search_base_block);
+
+        const float sign = m == metric::l2 ? 1.0f : -1.0f;
+        for(std::size_t q = 0; q < queries.rows(); q++){
+            const auto best = heaps[q].sorted();
+            for(std::size_t i = 0; i < k; i++){
+                if(i < best.size()){
+                    indices(q, i) = best[i].second;
+                    scores(q, i)  = sign * best[i].first;
+                }else{
+                    indices(q, i) = std::numeric_limits<std::size_t>::max();
+                    scores(q, i)  = sign * std::numeric_limits<float>::infinity();
+                }
+            }
+        }
+    }
+}
+
+#endif /* MEMORY_VIEW_SIMILARITY_SEARCH_HPP */
@@ -0,0 +1,323 @@
+/**
+ * @file   memory_view/include/memory_view/static_index.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  read only static B+tree over sorted keys stored in a byte view
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_STATIC_INDEX_HPP
+#define MEMORY_VIEW_STATIC_INDEX_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) */
+
+namespace memory_view{
+    namespace impl{
+        inline constexpr std::size_t index_node_bytes = 64;
+        inline constexpr std::size_t index_max_layers = 16;
+        inline constexpr char        index_magic[8]   = {'M', 'V', 'S', 'I', 'D', 'X', '1', '\0'};
+        // written in the byte order of the building machine, the keys and header use the same order
+        inline constexpr std::uint64_t index_byte_order = 0x0102030405060708;
+
+        // all offsets are relative to the start of the index, so it can be mapped anywhere
+        struct index_header{
+            char          magic[8];
+            std::uint64_t key_size;
+            std::uint64_t key_signed;
+            std::uint64_t size;         // number of keys
+            std::uint64_t layers;       // layer 0 holds the keys, the last one the root
+            std::uint64_t byte_order;   // index_byte_order
+            std::uint64_t reserved[2];
+            std::uint64_t layer_offset[index_max_layers];
+            std::uint64_t layer_nodes[index_max_layers];
+        };
+
+        inline constexpr std::size_t index_header_bytes =
+            (sizeof(index_header) + index_node_bytes - 1) / index_node_bytes * index_node_bytes;
+
+        inline std::size_t popcount(std::uint64_t x)noexcept{
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+            std::size_t n = 0;
+            for(; x; x &= x - 1)
+                n++;
+            return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+        }
+
+        /**
+         * Number of keys in node which are less than x (Strict) or less than or equal to x.
+         * With AVX2 all keys are compared at once, unsigned keys are compared
+         * as signed after flipping the sign bit.
+         */
+        template<bool Strict, typename K>
+        std::size_t node_count(const unsigned char* node, K x)noexcept{
+            constexpr std::size_t keys = index_node_bytes / sizeof(K);
+#if defined(__AVX2__)
+            if constexpr(sizeof(K) == 4 || sizeof(K) == 8){
+                const __m256i bias = std::is_signed_v<K> ? _mm256_setzero_si256()
+                                   : sizeof(K) == 4      ? _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min())
+                                                         : _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+                const __m256i v = _mm256_xor_si256(sizeof(K) == 4 ? _mm256_set1_epi32(static_cast<std::int32_t>(x))
+                                                                   : _mm256_set1_epi64x(static_cast<std::int64_t>(x)), bias);
+                const auto greater = [](__m256i a, __m256i b){
+                    return sizeof(K) == 4 ? _mm256_cmpgt_epi32(a, b) : _mm256_cmpgt_epi64(a, b);
+                };
+                const __m256i k0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(node)), bias);
+                const __m256i k1 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(node + 32)), bias);
+                // Strict: x > key, otherwise key > x counts the keys which are not counted
+                const __m256i m0 = Strict ? greater(v, k0) : greater(k0, v);
+                const __m256i m1 = Strict ? greater(v, k1) : greater(k1, v);
+                const std::uint64_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(m0)) |
+                                           std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(m1))} << 32;
+                const std::size_t bits = popcount(mask) / sizeof(K);
+                return Strict ? bits : keys - bits;
+            }
+#endif /* defined(__AVX2__) */
+            std::size_t count = 0;
+            for(std::size_t i = 0; i < keys; i++){
+                K k;
+                std::memcpy(&k, node + i * sizeof(K), sizeof(K));
+                count += Strict ? (k < x) : (k <= x);
+            }
+            return count;
+        }
+    }
+
+    /**
+     * A read only B+tree over sorted keys, stored in a byte view without pointers.
+     *
+     * Every node is a cache line of 64 / sizeof(K) keys, internal nodes have one more
+     * child than keys and the keys of a node are the first keys of its children
+     * after the first one. Queries descend from the root counting the keys of every
+     * node which are less than the query, the count selects the child.
+     *
+     * The layout only uses offsets relative to the start of the view, an index
+     * written to a file can be used directly from a mmapped view of the file.
+     */
+    template<typename K>
+    class static_index{
+        static_assert(std::is_integral_v<K>, "static_index requires integral keys");
+
+    public:
+        using key_type  = K;
+        using size_type = std::size_t;
+
+        static constexpr size_type npos       = std::numeric_limits<size_type>::max();
+        static constexpr size_type node_keys  = impl::index_node_bytes / sizeof(K);
+
+    private:
+        memory_view<const std::byte> _data;
+        size_type                    _size   = 0;
+        size_type                    _layers = 0;
+        size_type                    _layer_offset[impl::index_max_layers] = {};
+        size_type                    _layer_nodes[impl::index_max_layers]  = {};
+
+        const unsigned char* node(size_type layer, size_type k)const noexcept{
+            return reinterpret_cast<const unsigned char*>(_data.data()) + _layer_offset[layer] + k * impl::index_node_bytes;
+        }
+
+        template<bool Strict>
+        size_type search(K x)const noexcept{
+            size_type k = 0;
+            // the padding keys only count for the largest key, the child is clamped for them
+            for(size_type layer = _layers - 1; layer > 0; layer--)
+                k = std::min(k * (node_keys + 1) + impl::node_count<Strict>(node(layer, k), x), _layer_nodes[layer - 1] - 1);
+            return std::min(k * node_keys + impl::node_count<Strict>(node(0, k), x), _size);
+        }
+
+        static size_type layer_nodes(size_type n, size_type layer)noexcept{
+            size_type nodes = std::max<size_type>(1, (n + node_keys - 1) / node_keys);
+            for(; layer > 0; layer--)
+                nodes = (nodes + node_keys) / (node_keys + 1);
+            return nodes;
+        }
+
+        static size_type layer_count(size_type n)noexcept{
+            size_type layers = 1;
+            while(layer_nodes(n, layers - 1) > 1)
+                layers++;
+            return layers;
+        }
+
+    public:
+        constexpr static_index()noexcept = default;
+
+        /**
+         * Use an index built by build_static_index, throws std::out_of_range
+         * if data does not hold a valid index for K or was built on a machine
+         * of another byte order.
+         */
+        explicit static_index(memory_view<const std::byte> data):
+            _data{data}{
+            impl::index_header header;
+            if(data.size() < impl::index_header_bytes ||
+               reinterpret_cast<std::uintptr_t>(data.data()) % alignof(K) != 0)
+                impl::throw_out_of_range("memory_view::static_index");
+            std::memcpy(&header, data.data(), sizeof(header));
+            if(std::memcmp(header.magic, impl::index_magic, sizeof(header.magic)) != 0 ||
+               header.byte_order != impl::index_byte_order ||
+               header.key_size != sizeof(K) || header.key_signed != std::is_signed_v<K> ||
+               header.layers == 0 || header.layers > impl::index_max_layers ||
+               header.layers != layer_count(static_cast<size_type>(header.size)))
+                impl::throw_out_of_range("memory_view::static_index");
+            _size   = static_cast<size_type>(header.size);
+            _layers = static_cast<size_type>(header.layers);
+            for(size_type layer = 0; layer < _layers; layer++){
+                if(header.layer_nodes[layer] != layer_nodes(_size, layer) ||
+                   header.layer_offset[layer] > data.size() ||
+                   header.layer_nodes[layer] > (data.size() - header.layer_offset[layer]) / impl::index_node_bytes)
+                    impl::throw_out_of_range("memory_view::static_index");
+                _layer_offset[layer] = static_cast<size_type>(header.layer_offset[layer]);
+                _layer_nodes[layer]  = static_cast<size_type>(header.layer_nodes[layer]);
+            }
+        }
+
+        // bytes needed for an index of n keys
+        static size_type bytes_required(size_type n)noexcept{
+            size_type bytes = impl::index_header_bytes;
+            for(size_type layer = 0; layer < layer_count(n); layer++)
+                bytes += layer_nodes(n, layer) * impl::index_node_bytes;
+            return bytes;
+        }
+
+        /**
+         * Build the index of the sorted keys into out (bytes_required(keys.size()) bytes)
+         * and return a static_index over it.
+         */
+        static static_index build(memory_view<const K> keys, memory_view<std::byte> out){
+            const size_type n = keys.size();
+            const size_type layers = layer_count(n);
+            if(out.size() < bytes_required(n) || layers > impl::index_max_layers ||
+               reinterpret_cast<std::uintptr_t>(out.data()) % alignof(K) != 0)
+                impl::throw_out_of_range("memory_view::static_index::build");
+
+            impl::index_header header{};
+            std::memcpy(header.magic, impl::index_magic, sizeof(header.magic));
+            header.key_size   = sizeof(K);
+            header.key_signed = std::is_signed_v<K>;
+            header.byte_order = impl::index_byte_order;
+            header.size       = n;
+            header.layers     = layers;
+            // the root first, so the upper layers share pages
+            size_type offset = impl::index_header_bytes;
+            for(size_type layer = layers; layer-- > 0;){
+                header.layer_offset[layer] = offset;
+                header.layer_nodes[layer]  = layer_nodes(n, layer);
+                offset += layer_nodes(n, layer) * impl::index_node_bytes;
+            }
+            std::memset(out.data(), 0, impl::index_header_bytes);
+            std::memcpy(out.data(), &header, sizeof(header));
+
+            unsigned char* base = reinterpret_cast<unsigned char*>(out.data());
+            constexpr K pad = std::numeric_limits<K>::max();
+
+            // the leaves hold all keys, padded with the largest key
+            std::vector<K> firsts(layer_nodes(n, 0));
+            for(size_type k = 0; k < firsts.size(); k++){
+                K block[node_keys];
+                for(size_type i = 0; i < node_keys; i++)
+                    block[i] = k * node_keys + i < n ? keys.data()[k * node_keys + i] : pad;
+                std::memcpy(base + header.layer_offset[0] + k * impl::index_node_bytes, block, sizeof(block));
+                firsts[k] = block[0];
+            }
+
+            // every internal key is the first key of the child after it
+            for(size_type layer = 1; layer < layers; layer++){
+                std::vector<K> next(layer_nodes(n, layer));
+                for(size_type k = 0; k < next.size(); k++){
+                    K block[node_keys];
+                    for(size_type i = 0; i < node_keys; i++){
+                        const size_type child = k * (node_keys + 1) + i + 1;
+                        block[i] = child < firsts.size() ? firsts[child] : pad;
+                    }
+                    std::memcpy(base + header.layer_offset[layer] + k * impl::index_node_bytes, block, sizeof(block));
+                    next[k] = firsts[k * (node_keys + 1)];
+                }
+                firsts = std::move(next);
+            }
+            return static_index(memory_view<const std::byte>(out.data(), bytes_required(n)));
+        }
+
+        // number of keys
+        size_type size()const noexcept{
+            return _size;
+        }
+        bool empty()const noexcept{
+            return _size == 0;
+        }
+
+        // the bytes of the index
+        memory_view<const std::byte> data()const noexcept{
+            return _data;
+        }
+
+        // the key at position i of the sorted keys
+        K key(size_type i)const noexcept{
+            K k;
+            std::memcpy(&k, node(0, 0) + i * sizeof(K), sizeof(K));
+            return k;
+        }
+
+        // position of the first key not less than x
+        size_type lower_bound(K x)const noexcept{
+            return search<true>(x);
+        }
+
+        // position of the first key greater than x
+        size_type upper_bound(K x)const noexcept{
+            return search<false>(x);
+        }
+
+        // position of the first key equal to x or npos
+        size_type find(K x)const noexcept{
+            const size_type pos = lower_bound(x);
+            return pos < _size && key(pos) == x ? pos : npos;
+        }
+
+        // positions [first, last) of the keys in [lo, hi]
+        std::pair<size_type, size_type> range(K lo, K hi)const noexcept{
+            if(hi < lo)
+                return {0, 0};
+            return {lower_bound(lo), upper_bound(hi)};
+        }
+    };
+}
+
+#endif /* MEMORY_VIEW_STATIC_INDEX_HPP */
@@ -0,0 +1,528 @@
+/**
+ * @file   memory_view/include/memory_view/tensor_view.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  N-d strided view with broadcasting element wise kernels
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_TENSOR_VIEW_HPP
+#define MEMORY_VIEW_TENSOR_VIEW_HPP
+
+#include "../memory_view.hpp"
+#include "matrix_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace memory_view{
+    // maximum number of dimensions of a tensor_view
+    inline constexpr std::size_t max_rank = 8;
+
+    /**
+     * A N-d row major view with arbitrary strides (in elements),
+     * a stride of 0 repeats the same elements along a dimension.
+     */
+    template<typename T>
+    class tensor_view{
+    public:
+        // types:
+        using value_type      = T;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer         = value_type*;
+        using reference       = value_type&;
+        using shape_type      = std::array<size_type, max_rank>;
+        using strides_type    = std::array<difference_type, max_rank>;
+
+    private:
+        T*           _data;
+        size_type    _rank;
+        shape_type   _shape;
+        strides_type _strides;
+
+    public:
+        constexpr tensor_view()noexcept:
+            _data{nullptr},
+            _rank{0},
+            _shape{},
+            _strides{}{}
+
+        // construct from pointer, shape and strides of the first rank dimensions
+        constexpr tensor_view(pointer data, size_type rank, const shape_type& shape, const strides_type& strides):
+            _data{data},
+            _rank{rank},
+            _shape{},
+            _strides{}{
+            if(rank > max_rank)
+                impl::throw_out_of_range("tensor_view::tensor_view");
+            for(size_type i = 0; i < rank; i++){
+                _shape[i] = shape[i];
+                _strides[i] = strides[i];
+            }
+        }
+
+        constexpr tensor_view(pointer data, std::initializer_list<size_type> shape,
+                              std::initializer_list<difference_type> strides):
+            _data{data},
+            _rank{shape.size()},
+            _shape{},
+            _strides{}{
+            if(shape.size() > max_rank || shape.size() != strides.size())
+                impl::throw_out_of_range("tensor_view::tensor_view");
+            std::copy(shape.begin(), shape.end(), _shape.begin());
+            std::copy(strides.begin(), strides.end(), _strides.begin());
+        }
+
+        // contiguous row major tensor, the view must hold all elements
+        constexpr tensor_view(memory_view<T> data, std::initializer_list<size_type> shape):
+            _data{data.data()},
+            _rank{shape.size()},
+            _shape{},
+            _strides{}{
+            if(shape.size() > max_rank)
+                impl::throw_out_of_range("tensor_view::tensor_view");
+            std::copy(shape.begin(), shape.end(), _shape.begin());
+            difference_type stride = 1;
+            for(size_type i = _rank; i-- > 0;){
+                _strides[i] = stride;
+                stride *= static_cast<difference_type>(_shape[i]);
+            }
+            if(data.size() < size())
+                impl::throw_out_of_range("tensor_view::tensor_view");
+        }
+
+        template<typename U,
+                 typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr tensor_view(tensor_view<U> other)noexcept:
+            _data{other.data()},
+            _rank{other.rank()},
+            _shape{other.shape()},
+            _strides{other.strides()}{}
+
+        // capacity:
+        constexpr size_type rank()const noexcept{
+            return _rank;
+        }
+        constexpr size_type size()const noexcept{
+            size_type n = 1;
+            for(size_type i = 0; i < _rank; i++)
+                n *= _shape[i];
+            return n;
+        }
+        constexpr bool empty()const noexcept{
+            return size() == 0;
+        }
+        constexpr size_type shape(size_type i)const noexcept{
+            return _shape[i];
+        }
+        constexpr difference_type stride(size_type i)const noexcept{
+            return _strides[i];
+        }
+        constexpr const shape_type& shape()const noexcept{
+            return _shape;
+        }
+        constexpr const strides_type& strides()const noexcept{
+            return _strides;
+        }
+        // true for a row major layout without gaps
+        constexpr bool is_contiguous()const noexcept{
+            difference_type stride = 1;
+            for(size_type i = _rank; i-- > 0;){
+                if(_shape[i] != 1 && _strides[i] != stride)
+                    return false;
+                stride *= static_cast<difference_type>(_shape[i]);
+            }
+            return true;
+        }
+
+        // element access:
+        constexpr pointer data()const noexcept{
+            return _data;
+        }
+
+        template<typename... Index>
+        constexpr reference operator()(Index... index)const noexcept{
+            const size_type idx[] = {static_cast<size_type>(index)...};
+            difference_type offset = 0;
+            for(size_type i = 0; i < sizeof...(Index); i++)
+                offset += static_cast<difference_type>(idx[i]) * _strides[i];
+            return _data[offset];
+        }
+
+        /**
+         * View with the given shape following NumPy broadcasting rules,
+         * the dimensions are aligned at the end, size 1 dimensions are
+         * repeated with stride 0 and missing leading dimensions are added.
+         */
+        constexpr tensor_view broadcast_to(size_type rank, const shape_type& shape)const{
+            if(rank < _rank || rank > max_rank)
+                impl::throw_out_of_range("tensor_view::broadcast_to");
+            shape_type new_shape{};
+            strides_type new_strides{};
+            const size_type offset = rank - _rank;
+            for(size_type i = 0; i < rank; i++){
+                new_shape[i] = shape[i];
+                if(i < offset){
+                    new_strides[i] = 0;
+                }else if(_shape[i - offset] == shape[i]){
+                    new_strides[i] = _strides[i - offset];
+                }else if(_shape[i - offset] == 1){
+                    new_strides[i] = 0;
+                }else{
+                    impl::throw_out_of_range("tensor_view::broadcast_to");
+                }
+            }
+            return tensor_view(_data, rank, new_shape, new_strides);
+        }
+
+        /**
+         * View of the same elements (in row major order) with another shape,
+         * without copying. Returns std::nullopt when the strides do not allow it,
+         * use make_contiguous() to copy in that case.
+         * The number of elements must not change.
+         */
+        std::optional<tensor_view> reshape(std::initializer_list<size_type> shape)const{
+            if(shape.size() > max_rank)
+                impl::throw_out_of_range("tensor_view::reshape");
+            shape_type new_shape{};
+            strides_type new_strides{};
+            std::copy(shape.begin(), shape.end(), new_shape.begin());
+            const size_type new_rank = shape.size();
+            size_type n = 1;
+            for(size_type i = 0; i < new_rank; i++)
+                n *= new_shape[i];
+            if(n != size())
+                impl::throw_out_of_range("tensor_view::reshape");
+
+            // size 1 dimensions do not constrain the layout
+            shape_type old_shape{};
+            strides_type old_strides{};
+            size_type old_rank = 0;
+            for(size_type i = 0; i < _rank; i++){
+                if(_shape[i] != 1){
+                    old_shape[old_rank] = _shape[i];
+                    old_strides[old_rank] = _strides[i];
+                    old_rank++;
+                }
+            }
+
+            if(n == 0){
+                difference_type stride = 1;
+                for(size_type i = new_rank; i-- > 0;){
+                    new_strides[i] = stride;
+                    stride *= static_cast<difference_type>(new_shape[i]);
+                }
+                return tensor_view(_data, new_rank, new_shape, new_strides);
+            }
+
+            // match groups of old and new dimensions with equal products,
+            // every old group must be contiguous in itself
+            size_type oi = 0, oj = 1, ni = 0, nj = 1;
+            while(ni < new_rank && oi < old_rank){
+                size_type np = new_shape[ni];
+                size_type op = old_shape[oi];
+                while(np != op){
+                    if(np < op)
+                        np *= new_shape[nj++];
+                    else
+                        op *= old_shape[oj++];
+                }
+                for(size_type k = oi; k + 1 < oj; k++)
+                    if(old_strides[k] != static_cast<difference_type>(old_shape[k + 1]) * old_strides[k + 1])
+                        return std::nullopt;
+
+                new_strides[nj - 1] = old_strides[oj - 1];
+                for(size_type k = nj - 1; k > ni; k--)
+                    new_strides[k - 1] = new_strides[k] * static_cast<difference_type>(new_shape[k]);
+                ni = nj++;
+                oi = oj++;
+            }
+            // trailing size 1 dimensions
+            for(; ni < new_rank; ni++)
+                new_strides[ni] = 1;
+            return tensor_view(_data, new_rank, new_shape, new_strides);
+        }
+
+        // view with the dimensions reordered, dimension i of the result is axes[i] of this view
+        constexpr tensor_view permute(std::initializer_list<size_type> axes)const{
+            if(axes.size() != _rank)
+                impl::throw_out_of_range("tensor_view::permute");
+            shape_type new_shape{};
+            strides_type new_strides{};
+            std::array<bool, max_rank> used{};
+            size_type i = 0;
+            for(size_type axis : axes){
+                if(axis >= _rank || used[axis])
+                    impl::throw_out_of_range("tensor_view::permute");
+                used[axis] = true;
+                new_shape[i] = _shape[axis];
+                new_strides[i] = _strides[axis];
+                i++;
+            }
+            return tensor_view(_data, _rank, new_shape, new_strides);
+        }
+    };
+
+    /**
+     * Shape resulting from broadcasting all operands against each other,
+     * returns the rank, mismatching dimensions are reported as out of range.
+     */
+    template<typename... Tensors>
+    std::size_t broadcast_shape(std::array<std::size_t, max_rank>& shape, const Tensors&... tensors){
+        const std::size_t rank = std::max({tensors.rank()...});
+        shape.fill(1);
+        const auto merge = [&](const auto& t){
+            const std::size_t offset = rank - t.rank();
+            for(std::size_t i = 0; i < t.rank(); i++){
+                const std::size_t n = t.shape(i);
+                std::size_t& s = shape[offset + i];
+                if(s == 1)
+                    s = n;
+                else if(n != 1 && n != s)
+                    impl::throw_out_of_range("memory_view::broadcast_shape");
+            }
+        };
+        (merge(tensors), ...);
+        return rank;
+    }
+
+    namespace impl{
+        // operands of the innermost loop
+        template<typename T>
+        struct contiguous_operand{
+            T* p;
+            T& operator[](std::size_t i)const noexcept{
+                return p[i];
+            }
+        };
+        template<typename T>
+        struct scalar_operand{
+            T& v;
+            T& operator[](std::size_t)const noexcept{
+                return v;
+            }
+        };
+        template<typename T>
+        struct strided_operand{
+            T* p;
+            std::ptrdiff_t s;
+            T& operator[](std::size_t i)const noexcept{
+                return p[static_cast<std::ptrdiff_t>(i) * s];
+            }
+        };
+
+        template<typename Op, typename Out, typename... Ins>
+        void broadcast_inner(std::size_t n, Op& op, Out out, Ins... ins){
+            for(std::size_t i = 0; i < n; i++)
+                out[i] = op(ins[i]...);
+        }
+
+        // select the operand type of every input from its innermost stride, then run the loop
+        template<std::size_t I, typename Op, typename Out, typename Ptrs, typename... Ready>
+        void broadcast_dispatch(std::size_t n, Op& op, Out out, const Ptrs& ptrs,
+                                const std::ptrdiff_t* strides, Ready... ready){
+            if constexpr(I == std::tuple_size_v<Ptrs>){
+                broadcast_inner(n, op, out, ready...);
+            }else{
+                auto* p = std::get<I>(ptrs);
+                using U = std::remove_pointer_t<decltype(p)>;
+                if(strides[I] == 1)
+                    broadcast_dispatch<I + 1>(n, op, out, ptrs, strides, ready..., contiguous_operand<U>{p});
+                else if(strides[I] == 0)
+                    broadcast_dispatch<I + 1>(n, op, out, ptrs, strides, ready..., scalar_operand<U>{*p});
+                else
+                    broadcast_dispatch<I + 1>(n, op, out, ptrs, strides, ready..., strided_operand<U>{p, strides[I]});
+            }
+        }
+
+        /**
+         * Collapse the dimensions of out and all (already broadcast) inputs:
+         * size 1 dimensions are dropped and neighbours are merged when every
+         * operand steps through them as one dimension.
+         * Returns the new rank, strides[d][0] is the stride of out, strides[d][1 + k] of input k.
+         */
+        template<std::size_t N>
+        std::size_t collapse_dimensions(std::size_t rank, std::array<std::size_t, max_rank>& shape,
+                                        std::array<std::array<std::ptrdiff_t, N>, max_rank>& strides)noexcept{
+            std::size_t r = 0;
+            for(std::size_t i = 0; i < rank; i++){
+                if(shape[i] == 1)
+                    continue;
+                if(r > 0){
+                    bool mergeable = true;
+                    for(std::size_t k = 0; k < N; k++)
+                        if(strides[r - 1][k] != strides[i][k] * static_cast<std::ptrdiff_t>(shape[i]))
+                            mergeable = false;
+                    if(mergeable){
+                        shape[r - 1] *= shape[i];
+                        strides[r - 1] = strides[i];
+                        continue;
+                    }
+                }
+                shape[r] = shape[i];
+                strides[r] = strides[i];
+                r++;
+            }
+            if(r == 0){
+                shape[0] = 1;
+                strides[0].fill(0);
+                r = 1;
+            }
+            return r;
+        }
+    }
+
+    /**
+     * out = op(inputs...) element wise, the inputs are broadcast to the shape of out
+     * (which itself is not broadcast).
+     *
+     * The dimensions are collapsed as far as the strides allow and the innermost
+     * loop is specialized for contiguous, broadcast (stride 0) and strided operands,
+     * so e.g. a per channel normalization of a CHW or HWC tensor runs as a contiguous
+     * loop with the channel values held in registers.
+     */
+    template<typename T, typename Op, typename... Inputs>
+    void transform(tensor_view<T> out, Op op, tensor_view<Inputs>... inputs){
+        constexpr std::size_t N = 1 + sizeof...(Inputs);
+        const std::size_t rank = out.rank();
+        std::array<std::size_t, max_rank> shape = out.shape();
+
+        std::array<std::array<std::ptrdiff_t, N>, max_rank> strides{};
+        {
+            const std::array<typename tensor_view<T>::strides_type, N> all{
+                out.strides(), inputs.broadcast_to(rank, shape).strides()...};
+            for(std::size_t d = 0; d < rank; d++)
+                for(std::size_t k = 0; k < N; k++)
+                    strides[d][k] = all[k][d];
+        }
+        if(out.empty())
+            return;
+
+        const std::size_t r = impl::collapse_dimensions<N>(rank, shape, strides);
+        const std::size_t inner = shape[r - 1];
+        std::array<std::ptrdiff_t, N - 1> inner_strides{};
+        for(std::size_t k = 1; k < N; k++)
+            inner_strides[k - 1] = strides[r - 1][k];
+
+        // odometer over the outer dimensions
+        std::array<std::size_t, max_rank> index{};
+        T* po = out.data();
+        auto pi = std::make_tuple(inputs.data()...);
+        for(;;){
+            if(strides[r - 1][0] == 1)
+                impl::broadcast_dispatch<0>(inner, op, impl::contiguous_operand<T>{po}, pi, inner_strides.data());
+            else
+                impl::broadcast_dispatch<0>(inner, op, impl::strided_operand<T>{po, strides[r - 1][0]}, pi, inner_strides.data());
+
+            std::size_t d = r - 1;
+            for(;;){
+                if(d == 0)
+                    return;
+                d--;
+                std::size_t k = 0;
+                po += strides[d][0];
+                std::apply([&](auto*&... p){ ((p += strides[d][++k]), ...); }, pi);
+                if(++index[d] < shape[d])
+                    break;
+                const auto rewind = static_cast<std::ptrdiff_t>(shape[d]);
+                k = 0;
+                po -= strides[d][0] * rewind;
+                std::apply([&](auto*&... p){ ((p -= strides[d][++k] * rewind), ...); }, pi);
+                index[d] = 0;
+            }
+        }
+    }
+
+    /**
+     * Copy src into the contiguous tensor out of the same shape,
+     * e.g. to materialize a permuted (NHWC <-> NCHW) view.
+     *
+     * The dimensions are collapsed first, when src is contiguous along another
+     * dimension than the innermost one, every 2-D slice of these two dimensions
+     * is copied with the tiled transpose of matrix_view, otherwise the copy runs
+     * as an element wise transform. src and out must not overlap.
+     */
+    template<typename T, typename U>
+    void make_contiguous(tensor_view<T> src, tensor_view<U> out){
+        if(src.rank() != out.rank() || !out.is_contiguous())
+            impl::throw_out_of_range("memory_view::make_contiguous");
+        for(std::size_t i = 0; i < src.rank(); i++)
+            if(src.shape(i) != out.shape(i))
+                impl::throw_out_of_range("memory_view::make_contiguous");
+        if(out.empty())
+            return;
+
+        std::array<std::size_t, max_rank> shape = out.shape();
+        std::array<std::array<std::ptrdiff_t, 2>, max_rank> strides{};
+        for(std::size_t d = 0; d < out.rank(); d++)
+            strides[d] = {out.stride(d), src.stride(d)};
+        const std::size_t r = impl::collapse_dimensions<2>(out.rank(), shape, strides);
+
+        // dimension along which src is contiguous
+        std::size_t j = r;
+        for(std::size_t d = 0; d + 1 < r; d++)
+            if(strides[d][1] == 1)
+                j = d;
+        const std::size_t last = r - 1;
+        if(j == r || strides[last][1] <= 0){
+            transform(out, [](const auto& v){ return v; }, src);
+            return;
+        }
+
+        // odometer over all dimensions except j and last
+        std::array<std::size_t, max_rank> index{};
+        U* po = out.data();
+        T* ps = src.data();
+        for(;;){
+            transpose(matrix_view<T>(ps, shape[last], shape[j], static_cast<std::size_t>(strides[last][1])),
+                      matrix_view<U>(po, shape[j], shape[last], static_cast<std::size_t>(strides[j][0])));
+
+            std::size_t d = last;
+            for(;;){
+                if(d == 0)
+                    return;
+                d--;
+                if(d == j)
+                    continue;
+                po += strides[d][0];
+                ps += strides[d][1];
+                if(++index[d] < shape[d])
+                    break;
+                po -= strides[d][0] * static_cast<std::ptrdiff_t>(shape[d]);
+                ps -= strides[d][1] * static_cast<std::ptrdiff_t>(shape[d]);
+                index[d] = 0;
+            }
+        }
+    }
+}
+
+#endif /* MEMORY_VIEW_TENSOR_VIEW_HPP */
@@ -0,0 +1,352 @@
+/**
+ * @file   memory_view/include/memory_view/time_series.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  Gorilla style compression of time series into byte views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_TIME_SERIES_HPP
+#define MEMORY_VIEW_TIME_SERIES_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace memory_view{
+    namespace impl{
+        // the chunk starts with the number of points, most significant byte first like the bit stream
+        inline constexpr std::size_t series_header = sizeof(std::uint32_t);
+
+        inline void store_series_count(std::uint8_t* header, std::uint32_t count)noexcept{
+            for(std::size_t i = 0; i < series_header; i++)
+                header[i] = static_cast<std::uint8_t>(count >> (8 * (series_header - 1 - i)));
+        }
+
+        inline std::uint32_t load_series_count(const std::uint8_t* header)noexcept{
+            std::uint32_t count = 0;
+            for(std::size_t i = 0; i < series_header; i++)
+                count = (count << 8) | header[i];
+            return count;
+        }
+
+        inline unsigned leading_zeros(std::uint64_t x)noexcept{
+#if defined(__GNUC__) || defined(__clang__)
+            return x ? static_cast<unsigned>(__builtin_clzll(x)) : 64;
+#else
+            unsigned n = 0;
+            for(std::uint64_t bit = std::uint64_t{1} << 63; bit && !(x & bit); bit >>= 1)
+                n++;
+            return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+        }
+
+        inline unsigned trailing_zeros(std::uint64_t x)noexcept{
+#if defined(__GNUC__) || defined(__clang__)
+            return x ? static_cast<unsigned>(__builtin_ctzll(x)) : 64;
+#else
+            unsigned n = 0;
+            for(; n < 64 && !(x & (std::uint64_t{1} << n)); n++){}
+            return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+        }
+
+        inline std::int64_t sign_extend(std::uint64_t v, unsigned bits)noexcept{
+            const std::uint64_t sign = std::uint64_t{1} << (bits - 1);
+            return static_cast<std::int64_t>((v ^ sign) - sign);
+        }
+
+        // delta of delta buckets: prefix bits, prefix and payload bits
+        struct dod_bucket{
+            unsigned      prefix_bits;
+            std::uint64_t prefix;
+            unsigned      bits;
+        };
+        inline constexpr dod_bucket dod_buckets[] = {
+            {2, 0b10,   7},
+            {3, 0b110,  9},
+            {4, 0b1110, 12},
+            {4, 0b1111, 64},
+        };
+
+        // state shared by encoder and decoder
+        struct series_state{
+            std::int64_t  timestamp = 0;
+            std::int64_t  delta     = 0;
+            std::uint64_t value     = 0;
+            unsigned      leading   = 0;
+            unsigned      trailing  = 0;
+            bool          window    = false; // leading and trailing hold a previous window
+        };
+    }
+
+    /**
+     * Streaming compressor of (timestamp, value) points into a caller provided buffer.
+     *
+     * Timestamps are stored as delta of delta, values as the XOR with the previous
+     * value where only the meaningful bits are written (Gorilla, Pelkonen et al.).
+     * Regular timestamps cost 1 bit per point and repeated values 1 bit per point.
+     */
+    class series_encoder{
+        memory_view<std::uint8_t> _buffer;
+        std::size_t               _bit   = 8 * impl::series_header;
+        std::uint32_t             _count = 0;
+        impl::series_state        _state;
+        bool                      _overflow = false;
+
+        // most significant bit first
+        void write(std::uint64_t v, unsigned n)noexcept{
+            if(_bit + n > 8 * _buffer.size()){
+                _overflow = true;
+                return;
+            }
+            while(n){
+                const std::size_t byte = _bit / 8;
+                const unsigned    used = static_cast<unsigned>(_bit % 8);
+                if(used == 0)
+                    _buffer.data()[byte] = 0;
+                const unsigned take = std::min(8 - used, n);
+                const std::uint64_t bits = (v >> (n - take)) & ((1u << take) - 1);
+                _buffer.data()[byte] |= static_cast<std::uint8_t>(bits << (8 - used - take));
+                _bit += take;
+                n    -= take;
+            }
+        }
+
+        void write_timestamp(std::int64_t timestamp)noexcept{
+            if(_count == 0){
+                write(static_cast<std::uint64_t>(timestamp), 64);
+                _state.timestamp = timestamp;
+                return;
+            }
+            const std::int64_t delta = static_cast<std::int64_t>(static_cast<std::uint64_t>(timestamp) -
+                                                                 static_cast<std::uint64_t>(_state.timestamp));
+            const std::int64_t dod   = static_cast<std::int64_t>(static_cast<std::uint64_t>(delta) -
+                                                                 static_cast<std::uint64_t>(_state.delta));
+            if(dod == 0){
+                write(0, 1);
+            }else{
+                for(const auto& bucket : impl::dod_buckets){
+                    const std::int64_t limit = bucket.bits == 64 ? 0 : std::int64_t{1} << (bucket.bits - 1);
+                    if(bucket.bits == 64 || (dod >= -limit && dod < limit)){
+                        write(bucket.prefix, bucket.prefix_bits);
+                        write(static_cast<std::uint64_t>(dod), bucket.bits);
+                        break;
+                    }
+                }
+            }
+            _state.timestamp = timestamp;
+            _state.delta     = delta;
+        }
+
+        void write_value(double value)noexcept{
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if(_count == 0){
+                write(bits, 64);
+                _state.value = bits;
+                return;
+            }
+            const std::uint64_t x = bits ^ _state.value;
+            _state.value = bits;
+            if(x == 0){
+                write(0, 1);
+                return;
+            }
+            // the leading count is stored in 5 bits
+            const unsigned leading  = std::min(impl::leading_zeros(x), 31u);
+            const unsigned trailing = impl::trailing_zeros(x);
+            if(_state.window && leading >= _state.leading && trailing >= _state.trailing){
+                // the meaningful bits fit into the previous window
+                write(0b10, 2);
+                write(x >> _state.trailing, 64 - _state.leading - _state.trailing);
+            }else{
+                const unsigned meaningful = 64 - leading - trailing;
+                write(0b11, 2);
+                write(leading, 5);
+                write(meaningful & 63, 6); // 64 is stored as 0
+                write(x >> trailing, meaningful);
+                _state.leading  = leading;
+                _state.trailing = trailing;
+                _state.window   = true;
+            }
+        }
+
+    public:
+        explicit series_encoder(memory_view<std::uint8_t> buffer):
+            _buffer{buffer}{
+            if(buffer.size() < impl::series_header)
+                impl::throw_out_of_range("memory_view::series_encoder");
+            std::memset(buffer.data(), 0, impl::series_header);
+        }
+
+        /**
+         * Append a point, returns false and leaves the chunk unchanged
+         * if the point does not fit into the buffer.
+         */
+        bool append(std::int64_t timestamp, double value)noexcept{
+            if(_count == std::numeric_limits<std::uint32_t>::max())
+                return false;
+            const std::size_t        bit   = _bit;
+            const impl::series_state state = _state;
+            write_timestamp(timestamp);
+            write_value(value);
+            if(_overflow){
+                // roll back, clearing the bits written into the last partial byte
+                _bit      = bit;
+                _state    = state;
+                _overflow = false;
+                if(_bit % 8)
+                    _buffer.data()[_bit / 8] &= static_cast<std::uint8_t>(0xFF00u >> (_bit % 8));
+                return false;
+            }
+            _count++;
+            impl::store_series_count(_buffer.data(), _count);
+            return true;
+        }
+
+        // number of points appended
+        std::size_t size()const noexcept{
+            return _count;
+        }
+
+        // the encoded chunk, valid for a series_decoder after every append
+        memory_view<const std::uint8_t> data()const noexcept{
+            return memory_view<const std::uint8_t>(_buffer.data(), (_bit + 7) / 8);
+        }
+    };
+
+    /**
+     * Decompress a chunk written by series_encoder in batches.
+     */
+    class series_decoder{
+        memory_view<const std::uint8_t> _data;
+        std::size_t                     _bit   = 8 * impl::series_header;
+        std::size_t                     _count = 0;
+        std::size_t                     _index = 0;
+        impl::series_state              _state;
+
+        std::uint64_t read(unsigned n){
+            if(_bit + n > 8 * _data.size())
+                impl::throw_out_of_range("memory_view::series_decoder");
+            std::uint64_t v = 0;
+            while(n){
+                const unsigned used = static_cast<unsigned>(_bit % 8);
+                const unsigned take = std::min(8 - used, n);
+                const unsigned byte = _data.data()[_bit / 8];
+                v = (v << take) | ((byte >> (8 - used - take)) & ((1u << take) - 1));
+                _bit += take;
+                n    -= take;
+            }
+            return v;
+        }
+
+        std::int64_t read_timestamp(){
+            if(_index == 0){
+                _state.timestamp = static_cast<std::int64_t>(read(64));
+                return _state.timestamp;
+            }
+            std::int64_t dod = 0;
+            if(read(1)){
+                unsigned prefix_bits = 1;
+                std::uint64_t prefix = 1;
+                for(const auto& bucket : impl::dod_buckets){
+                    while(prefix_bits < bucket.prefix_bits){
+                        prefix = (prefix << 1) | read(1);
+                        prefix_bits++;
+                    }
+                    if(prefix == bucket.prefix){
+                        dod = bucket.bits == 64 ? static_cast<std::int64_t>(read(64))
+                                                : impl::sign_extend(read(bucket.bits), bucket.bits);
+                        break;
+                    }
+                }
+            }
+            _state.delta = static_cast<std::int64_t>(static_cast<std::uint64_t>(_state.delta) + static_cast<std::uint64_t>(dod));
+            _state.timestamp = static_cast<std::int64_t>(static_cast<std::uint64_t>(_state.timestamp) +
+                                                         static_cast<std::uint64_t>(_state.delta));
+            return _state.timestamp;
+        }
+
+        double read_value(){
+            if(_index == 0){
+                _state.value = read(64);
+            }else if(read(1)){
+                if(read(1)){
+                    _state.leading = static_cast<unsigned>(read(5));
+                    unsigned meaningful = static_cast<unsigned>(read(6));
+                    if(meaningful == 0)
+                        meaningful = 64;
+                    if(_state.leading + meaningful > 64)
+                        impl::throw_out_of_range("memory_view::series_decoder");
+                    _state.trailing = 64 - _state.leading - meaningful;
+                }
+                _state.value ^= read(64 - _state.leading - _state.trailing) << _state.trailing;
+            }
+            double value;
+            std::memcpy(&value, &_state.value, sizeof(value));
+            return value;
+        }
+
+    public:
+        explicit series_decoder(memory_view<const std::uint8_t> data):
+            _data{data}{
+            if(data.size() < impl::series_header)
+                impl::throw_out_of_range("memory_view::series_decoder");
+            _count = impl::load_series_count(data.data());
+        }
+
+        // number of points in the chunk
+        std::size_t size()const noexcept{
+            return _count;
+        }
+
+        // number of points not yet decoded
+        std::size_t remaining()const noexcept{
+            return _count - _index;
+        }
+
+        /**
+         * Decode the next min(remaining(), timestamps.size()) points,
+         * returns the number of points decoded. values.size() == timestamps.size()
+         */
+        std::size_t decode(memory_view<std::int64_t> timestamps, memory_view<double> values){
+            if(timestamps.size() != values.size())
+                impl::throw_out_of_range("memory_view::series_decoder::decode");
+            const std::size_t n = std::min(remaining(), timestamps.size());
+            for(std::size_t i = 0; i < n; i++, _index++){
+                timestamps.data()[i] = read_timestamp();
+                values.data()[i]     = read_value();
+            }
+            return n;
+        }
+    };
+}
+
+#endif /* MEMORY_VIEW_TIME_SERIES_HPP */
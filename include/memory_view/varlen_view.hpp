@@ -0,0 +1,281 @@
+/**
+ * @file   memory_view/include/memory_view/varlen_view.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  arrays of variable length elements stored as offsets and data
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_VARLEN_VIEW_HPP
+#define MEMORY_VIEW_VARLEN_VIEW_HPP
+
+#include "../memory_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace memory_view{
+    /**
+     * A view of size() variable length elements (strings, blobs) stored back to back in data,
+     * element i is data[offsets[i], offsets[i + 1]), offsets holds size() + 1 ascending values.
+     *
+     * Slicing shares data and offsets, the offsets of a slice stay relative to the whole data.
+     */
+    template<typename Offset = std::uint32_t>
+    class basic_varlen_view{
+        memory_view<const char>   _data;
+        memory_view<const Offset> _offsets;
+
+    public:
+        // types:
+        using value_type      = memory_view<const char>;
+        using reference       = value_type;
+        using offset_type     = Offset;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        static const size_type npos = std::numeric_limits<size_type>::max();
+
+        class iterator{
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = basic_varlen_view::value_type;
+            using difference_type   = basic_varlen_view::difference_type;
+            using reference         = basic_varlen_view::reference;
+            using pointer           = void;
+
+        private:
+            const char*   _data;
+            const Offset* _offsets;
+
+        public:
+            constexpr iterator()noexcept:
+                _data{nullptr},
+                _offsets{nullptr}{}
+
+            constexpr iterator(const char* data, const Offset* offsets)noexcept:
+                _data{data},
+                _offsets{offsets}{}
+
+            constexpr reference operator*()const noexcept{
+                return reference(_data + _offsets[0], static_cast<std::size_t>(_offsets[1] - _offsets[0]));
+            }
+            constexpr reference operator[](difference_type n)const noexcept{
+                return *(*this + n);
+            }
+
+            constexpr iterator& operator++()noexcept{
+                ++_offsets;
+                return *this;
+            }
+            constexpr iterator operator++(int)noexcept{
+                iterator tmp = *this;
+                ++_offsets;
+                return tmp;
+            }
+            constexpr iterator& operator--()noexcept{
+                --_offsets;
+                return *this;
+            }
+            constexpr iterator operator--(int)noexcept{
+                iterator tmp = *this;
+                --_offsets;
+                return tmp;
+            }
+            constexpr iterator& operator+=(difference_type n)noexcept{
+                _offsets += n;
+                return *this;
+            }
+            constexpr iterator& operator-=(difference_type n)noexcept{
+                _offsets -= n;
+                return *this;
+            }
+
+            friend constexpr iterator operator+(iterator it, difference_type n)noexcept{
+                return it += n;
+            }
+            friend constexpr iterator operator+(difference_type n, iterator it)noexcept{
+                return it += n;
+            }
+            friend constexpr iterator operator-(iterator it, difference_type n)noexcept{
+                return it -= n;
+            }
+            friend constexpr difference_type operator-(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets - rhs._offsets;
+            }
+
+            friend constexpr bool operator==(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets == rhs._offsets;
+            }
+            friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets != rhs._offsets;
+            }
+            friend constexpr bool operator< (const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets < rhs._offsets;
+            }
+            friend constexpr bool operator> (const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets > rhs._offsets;
+            }
+            friend constexpr bool operator<=(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets <= rhs._offsets;
+            }
+            friend constexpr bool operator>=(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._offsets >= rhs._offsets;
+            }
+        };
+
+        constexpr basic_varlen_view()noexcept = default;
+
+        /**
+         * offsets is either empty or holds one more value than elements,
+         * the last offset must not be past the end of data.
+         */
+        constexpr basic_varlen_view(memory_view<const char> data, memory_view<const Offset> offsets):
+            _data{data},
+            _offsets{offsets}{
+            if(!offsets.empty() && (offsets.data()[offsets.size() - 1] > data.size() ||
+                                    offsets.data()[0] > offsets.data()[offsets.size() - 1]))
+                impl::throw_out_of_range("memory_view::varlen_view");
+        }
+
+        // iterators:
+        constexpr iterator begin()const noexcept{
+            return iterator(_data.data(), _offsets.data());
+        }
+        constexpr iterator end()const noexcept{
+            return iterator(_data.data(), _offsets.data() + size());
+        }
+
+        // capacity:
+        constexpr bool empty()const noexcept{
+            return size() == 0;
+        }
+        constexpr size_type size()const noexcept{
+            return _offsets.empty() ? 0 : _offsets.size() - 1;
+        }
+        // bytes of all elements
+        constexpr size_type nbytes()const noexcept{
+            return empty() ? 0 : static_cast<size_type>(_offsets.data()[size()] - _offsets.data()[0]);
+        }
+
+        // element access:
+        constexpr reference operator[](size_type n)const noexcept{
+            return begin()[static_cast<difference_type>(n)];
+        }
+        constexpr reference at(size_type n)const{
+            if(n >= size())
+                impl::throw_out_of_range("memory_view::varlen_view::at");
+            return (*this)[n];
+        }
+        constexpr reference front()const noexcept{
+            return (*this)[0];
+        }
+        constexpr reference back()const noexcept{
+            return (*this)[size() - 1];
+        }
+
+        constexpr memory_view<const char> data()const noexcept{
+            return _data;
+        }
+        constexpr memory_view<const Offset> offsets()const noexcept{
+            return _offsets;
+        }
+
+        // elements [pos, pos + count), sharing data and offsets
+        constexpr basic_varlen_view view(size_type pos = 0, size_type count = npos)const{
+            if(pos > size())
+                impl::throw_out_of_range("memory_view::varlen_view::view");
+            count = std::min(count, size() - pos);
+            basic_varlen_view result;
+            result._data    = _data;
+            result._offsets = _offsets.view(pos, count + 1);
+            return result;
+        }
+    };
+
+    using varlen_view = basic_varlen_view<std::uint32_t>;
+
+    /**
+     * Append variable length elements into caller provided data and offsets buffers
+     * (e.g. carved out of an arena), offsets needs one more slot than elements.
+     */
+    template<typename Offset = std::uint32_t>
+    class basic_varlen_builder{
+        memory_view<char>   _data;
+        memory_view<Offset> _offsets;
+        std::size_t         _size  = 0;
+        std::size_t         _bytes = 0;
+
+    public:
+        basic_varlen_builder(memory_view<char> data, memory_view<Offset> offsets):
+            _data{data},
+            _offsets{offsets}{
+            if(offsets.empty())
+                impl::throw_out_of_range("memory_view::varlen_builder");
+            offsets.data()[0] = 0;
+        }
+
+        /**
+         * Append a copy of value, returns false and leaves
+         * the builder unchanged if it does not fit.
+         */
+        bool append(memory_view<const char> value)noexcept{
+            if(_size + 1 >= _offsets.size() || value.size() > _data.size() - _bytes ||
+               _bytes + value.size() > std::numeric_limits<Offset>::max())
+                return false;
+            if(!value.empty())
+                std::memcpy(_data.data() + _bytes, value.data(), value.size());
+            _bytes += value.size();
+            _offsets.data()[++_size] = static_cast<Offset>(_bytes);
+            return true;
+        }
+
+        // forget all elements, the buffers are reused
+        void clear()noexcept{
+            _size  = 0;
+            _bytes = 0;
+        }
+
+        std::size_t size()const noexcept{
+            return _size;
+        }
+        std::size_t nbytes()const noexcept{
+            return _bytes;
+        }
+
+        // the elements appended so far
+        basic_varlen_view<Offset> view()const{
+            return basic_varlen_view<Offset>(_data.first(_bytes), _offsets.first(_size + 1));
+        }
+    };
+
+    using varlen_builder = basic_varlen_builder<std::uint32_t>;
+}
+
+#endif /* MEMORY_VIEW_VARLEN_VIEW_HPP */
@@ -0,0 +1,263 @@
+/**
+ * @file   memory_view/include/memory_view/window.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  sliding window aggregates over streams of views
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_WINDOW_HPP
+#define MEMORY_VIEW_WINDOW_HPP
+
+#include "../memory_view.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace memory_view{
+    namespace impl{
+        // the last window values of a stream
+        class window_ring{
+            std::vector<float> _values;
+            std::size_t        _next  = 0;
+            std::size_t        _count = 0;
+
+        public:
+            explicit window_ring(std::size_t window):
+                _values(window){
+                if(window == 0)
+                    throw_out_of_range("memory_view::window");
+            }
+
+            std::size_t window()const noexcept{
+                return _values.size();
+            }
+            std::size_t count()const noexcept{
+                return _count;
+            }
+            void reset()noexcept{
+                _next  = 0;
+                _count = 0;
+            }
+
+            // add x, returns true and sets evicted if the oldest value dropped out of the window
+            bool push(float x, float& evicted)noexcept{
+                const bool full = _count == _values.size();
+                evicted = _values[_next];
+                _values[_next] = x;
+                _next = _next + 1 == _values.size() ? 0 : _next + 1;
+                if(!full)
+                    _count++;
+                return full;
+            }
+        };
+
+        inline void check_window_views(memory_view<const float> in, memory_view<float> out, const char* s){
+            if(in.size() != out.size())
+                throw_out_of_range(s);
+        }
+
+        /**
+         * Minimum (Compare = std::less) or maximum (std::greater) with a monotonic deque,
+         * the deque holds the candidates of the window ordered by Compare in a ring of window slots.
+         */
+        template<typename Compare>
+        class window_extremum{
+            struct entry{
+                std::uint64_t index;
+                float         value;
+            };
+            std::vector<entry> _deque;
+            std::size_t        _front = 0;
+            std::size_t        _size  = 0;
+            std::uint64_t      _index = 0;
+            Compare            _compare;
+
+            std::size_t slot(std::size_t i)const noexcept{
+                const std::size_t s = _front + i;
+                return s >= _deque.size() ? s - _deque.size() : s;
+            }
+
+        public:
+            explicit window_extremum(std::size_t window):
+                _deque(window){
+                if(window == 0)
+                    throw_out_of_range("memory_view::window");
+            }
+
+            std::size_t window()const noexcept{
+                return _deque.size();
+            }
+
+            // forget the stream, as if the aggregate was just constructed
+            void reset()noexcept{
+                _front = 0;
+                _size  = 0;
+                _index = 0;
+            }
+
+            // out[i] is the extremum of the last window values up to in[i], in and out may be the same view
+            void process(memory_view<const float> in, memory_view<float> out){
+                check_window_views(in, out, "memory_view::window::process");
+                const std::size_t window = _deque.size();
+                for(std::size_t i = 0; i < in.size(); i++, _index++){
+                    const float x = in.data()[i];
+                    if(_size && _deque[_front].index + window <= _index){
+                        _front = slot(1);
+                        _size--;
+                    }
+                    // drop the candidates which can never be the extremum again
+                    while(_size && !_compare(_deque[slot(_size - 1)].value, x))
+                        _size--;
+                    _deque[slot(_size++)] = {_index, x};
+                    out.data()[i] = _deque[_front].value;
+                }
+            }
+        };
+    }
+
+    // moving sum of the last window values
+    class window_sum{
+        impl::window_ring _ring;
+        double            _sum = 0.0;
+
+    public:
+        explicit window_sum(std::size_t window):
+            _ring{window}{}
+
+        std::size_t window()const noexcept{
+            return _ring.window();
+        }
+
+        // forget the stream, as if the aggregate was just constructed
+        void reset()noexcept{
+            _ring.reset();
+            _sum = 0.0;
+        }
+
+        /**
+         * out[i] is the sum of the last window values up to in[i], including the
+         * previous batches, fewer at the start of the stream. in and out may be the same view.
+         */
+        void process(memory_view<const float> in, memory_view<float> out){
+            impl::check_window_views(in, out, "memory_view::window_sum::process");
+            for(std::size_t i = 0; i < in.size(); i++){
+                float evicted;
+                const float x = in.data()[i];
+                if(_ring.push(x, evicted))
+                    _sum -= static_cast<double>(evicted);
+                _sum += static_cast<double>(x);
+                out.data()[i] = static_cast<float>(_sum);
+            }
+        }
+    };
+
+    // moving average of the last window values
+    class window_mean{
+        impl::window_ring _ring;
+        double            _sum = 0.0;
+
+    public:
+        explicit window_mean(std::size_t window):
+            _ring{window}{}
+
+        std::size_t window()const noexcept{
+            return _ring.window();
+        }
+
+        // forget the stream, as if the aggregate was just constructed
+        void reset()noexcept{
+            _ring.reset();
+            _sum = 0.0;
+        }
+
+        // out[i] is the mean of the last window values up to in[i], in and out may be the same view
+        void process(memory_view<const float> in, memory_view<float> out){
+            impl::check_window_views(in, out, "memory_view::window_mean::process");
+            for(std::size_t i = 0; i < in.size(); i++){
+                float evicted;
+                const float x = in.data()[i];
+                if(_ring.push(x, evicted))
+                    _sum -= static_cast<double>(evicted);
+                _sum += static_cast<double>(x);
+                out.data()[i] = static_cast<float>(_sum / static_cast<double>(_ring.count()));
+            }
+        }
+    };
+
+    // moving minimum and maximum of the last window values
+    using window_min = impl::window_extremum<std::less<float>>;
+    using window_max = impl::window_extremum<std::greater<float>>;
+
+    // moving (population) variance of the last window values, updated with Welford's method
+    class window_variance{
+        impl::window_ring _ring;
+        double            _mean = 0.0;
+        double            _m2   = 0.0; // sum of squared differences from the mean
+
+    public:
+        explicit window_variance(std::size_t window):
+            _ring{window}{}
+
+        std::size_t window()const noexcept{
+            return _ring.window();
+        }
+
+        // forget the stream, as if the aggregate was just constructed
+        void reset()noexcept{
+            _ring.reset();
+            _mean = 0.0;
+            _m2   = 0.0;
+        }
+
+        // out[i] is the variance of the last window values up to in[i], in and out may be the same view
+        void process(memory_view<const float> in, memory_view<float> out){
+            impl::check_window_views(in, out, "memory_view::window_variance::process");
+            for(std::size_t i = 0; i < in.size(); i++){
+                float evicted;
+                const double x = static_cast<double>(in.data()[i]);
+                if(_ring.push(in.data()[i], evicted)){
+                    // replace evicted by x, the count stays the same
+                    const double n     = static_cast<double>(_ring.count());
+                    const double delta = x - static_cast<double>(evicted);
+                    const double mean  = _mean + delta / n;
+                    _m2  += delta * (x - mean + static_cast<double>(evicted) - _mean);
+                    _mean = mean;
+                }else{
+                    const double n     = static_cast<double>(_ring.count());
+                    const double delta = x - _mean;
+                    _mean += delta / n;
+                    _m2   += delta * (x - _mean);
+                }
+                out.data()[i] = static_cast<float>(std::fmax(_m2, 0.0) / static_cast<double>(_ring.count()));
+            }
+        }
+    };
+}
+
+#endif /* MEMORY_VIEW_WINDOW_HPP */
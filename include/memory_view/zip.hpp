@@ -0,0 +1,248 @@
+/**
+ * @file   memory_view/include/memory_view/zip.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  iterate multiple memory_views of equal size together
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Peter Züger
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef MEMORY_VIEW_ZIP_HPP
+#define MEMORY_VIEW_ZIP_HPP
+
+#include "../memory_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+namespace memory_view{
+    template<typename... Views>
+    class zip_view{
+        std::tuple<Views...> _views;
+        std::size_t          _size;
+
+        template<typename F, std::size_t... I>
+        void for_each_block(std::size_t pos, std::size_t count, F& f, std::index_sequence<I...>)const{
+            f(std::get<I>(_views).subview_clamped(pos, count)...);
+        }
+
+    public:
+        // types:
+        using value_type      = std::tuple<typename Views::value_type...>;
+        using reference       = std::tuple<typename Views::reference...>;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        static const size_type npos = std::numeric_limits<size_type>::max();
+
+        class iterator{
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = zip_view::value_type;
+            using difference_type   = zip_view::difference_type;
+            using reference         = zip_view::reference;
+            using pointer           = void;
+
+        private:
+            std::tuple<typename Views::pointer...> _ptrs;
+            difference_type                        _pos;
+
+            template<std::size_t... I>
+            constexpr reference get(difference_type n, std::index_sequence<I...>)const noexcept{
+                return reference(std::get<I>(_ptrs)[_pos + n]...);
+            }
+
+        public:
+            constexpr iterator()noexcept:
+                _ptrs{},
+                _pos{0}{}
+
+            constexpr iterator(std::tuple<typename Views::pointer...> ptrs, difference_type pos)noexcept:
+                _ptrs{ptrs},
+                _pos{pos}{}
+
+            constexpr reference operator*()const noexcept{
+                return get(0, std::index_sequence_for<Views...>{});
+            }
+            constexpr reference operator[](difference_type n)const noexcept{
+                return get(n, std::index_sequence_for<Views...>{});
+            }
+
+            constexpr iterator& operator++()noexcept{
+                ++_pos;
+                return *this;
+            }
+            constexpr iterator operator++(int)noexcept{
+                iterator tmp = *this;
+                ++_pos;
+                return tmp;
+            }
+            constexpr iterator& operator--()noexcept{
+                --_pos;
+                return *this;
+            }
+            constexpr iterator operator--(int)noexcept{
+                iterator tmp = *this;
+                --_pos;
+                return tmp;
+            }
+            constexpr iterator& operator+=(difference_type n)noexcept{
+                _pos += n;
+                return *this;
+            }
+            constexpr iterator& operator-=(difference_type n)noexcept{
+                _pos -= n;
+                return *this;
+            }
+
+            friend constexpr iterator operator+(iterator it, difference_type n)noexcept{
+                return it += n;
+            }
+            friend constexpr iterator operator+(difference_type n, iterator it)noexcept{
+                return it += n;
+            }
+            friend constexpr iterator operator-(iterator it, difference_type n)noexcept{
+                return it -= n;
+            }
+            friend constexpr difference_type operator-(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos - rhs._pos;
+            }
+
+            friend constexpr bool operator==(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos == rhs._pos;
+            }
+            friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos != rhs._pos;
+            }
+            friend constexpr bool operator< (const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos < rhs._pos;
+            }
+            friend constexpr bool operator> (const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos > rhs._pos;
+            }
+            friend constexpr bool operator<=(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos <= rhs._pos;
+            }
+            friend constexpr bool operator>=(const iterator& lhs, const iterator& rhs)noexcept{
+                return lhs._pos >= rhs._pos;
+            }
+        };
+
+        // all views must have the same size
+        constexpr zip_view(Views... views):
+            _views{views...},
+            _size{std::get<0>(_views).size()}{
+            if(!((views.size() == _size) && ...))
+                impl::throw_out_of_range("memory_view::zip_view");
+        }
+
+        // iterators:
+        constexpr iterator begin()const noexcept{
+            return iterator(pointers(), 0);
+        }
+        constexpr iterator end()const noexcept{
+            return iterator(pointers(), static_cast<difference_type>(size()));
+        }
+
+        // capacity:
+        constexpr bool empty()const noexcept{
+            return size() == 0;
+        }
+        constexpr size_type size()const noexcept{
+            return _size;
+        }
+
+        // element access:
+        constexpr reference operator[](size_type n)const noexcept{
+            return begin()[static_cast<difference_type>(n)];
+        }
+
+        constexpr std::tuple<typename Views::pointer...> pointers()const noexcept{
+            return std::apply([](auto... views){
+                return std::make_tuple(views.data()...);
+            }, _views);
+        }
+
+        constexpr const std::tuple<Views...>& views()const noexcept{
+            return _views;
+        }
+
+        constexpr zip_view view(size_type pos = 0, size_type count = npos)const{
+            return std::apply([pos, count](const auto&... views){
+                return zip_view(views.view(pos, count)...);
+            }, _views);
+        }
+
+        /**
+         * Call f(subviews...) for consecutive blocks of at most block_size elements,
+         * every call gets equally sized subviews of all views.
+         *
+         * With an alignment (in bytes) the first block is shortened to the first element
+         * of the first view on an aligned address and block_size is rounded up to a
+         * multiple of alignment / gcd(alignment, sizeof(value_type)) elements, so all
+         * following blocks of the first view start on an aligned address. If no element
+         * of the first view is aligned the blocks are neither shortened nor rounded.
+         * The other views are only aligned if they are misaligned like the first view.
+         * Throws std::out_of_range if block_size is 0.
+         */
+        template<typename F>
+        void for_each_block(size_type block_size, F f, size_type alignment = 0)const{
+            if(block_size == 0)
+                impl::throw_out_of_range("memory_view::zip_view::for_each_block");
+
+            size_type pos = 0;
+            if(alignment > 1){
+                using first = std::tuple_element_t<0, std::tuple<Views...>>;
+                constexpr size_type element = sizeof(typename first::value_type);
+                const auto addr = reinterpret_cast<std::uintptr_t>(std::get<0>(_views).data());
+                // the element addresses repeat modulo alignment after period elements
+                const size_type period = alignment / std::gcd(alignment, element);
+                size_type head = 0;
+                while(head < period && (addr + head * element) % alignment != 0)
+                    head++;
+                if(head < period){
+                    block_size = (block_size + period - 1) / period * period;
+                    if(head > 0){
+                        for_each_block(0, std::min(head, size()), f, std::index_sequence_for<Views...>{});
+                        pos = head;
+                    }
+                }
+            }
+            for(; pos < size(); pos += block_size)
+                for_each_block(pos, block_size, f, std::index_sequence_for<Views...>{});
+        }
+    };
+
+    template<typename... Views>
+    constexpr zip_view<Views...> zip(Views... views){
+        return zip_view<Views...>(views...);
+    }
+}
+
+#endif /* MEMORY_VIEW_ZIP_HPP */
@@ -0,0 +1,171 @@
+/**
+ * @file   memory_view/test/algorithm.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  overlapping moves, rotations, shifts and fills against the standard algorithms
+ */
+#include "test.hpp"
+
+#include <memory_view/algorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace mv = memory_view;
+
+int main(){
+    // rotate against std::rotate for every middle, trivial and non trivial types
+    for(std::size_t n = 0; n < 70; n += 3){
+        for(std::size_t middle = 0; middle <= n; middle++){
+            std::vector<int> a(n), b(n);
+            std::iota(a.begin(), a.end(), 0);
+            std::iota(b.begin(), b.end(), 0);
+            mv::rotate(mv::memory_view<int>(a.data(), a.size()), middle);
+            std::rotate(b.begin(), b.begin() + static_cast<std::ptrdiff_t>(middle), b.end());
+            CHECK(a == b);
+
+            std::vector<std::string> s(n), t(n);
+            for(std::size_t i = 0; i < n; i++)
+                s[i] = t[i] = std::to_string(i);
+            mv::rotate(mv::memory_view<std::string>(s.data(), s.size()), middle);
+            std::rotate(t.begin(), t.begin() + static_cast<std::ptrdiff_t>(middle), t.end());
+            CHECK(s == t);
+        }
+    }
+    // large enough to need several chunks in swap_blocks
+    {
+        std::vector<double> a(1000), b(1000);
+        std::iota(a.begin(), a.end(), 0.0);
+        std::iota(b.begin(), b.end(), 0.0);
+        mv::rotate(mv::memory_view<double>(a.data(), a.size()), 377);
+        std::rotate(b.begin(), b.begin() + 377, b.end());
+        CHECK(a == b);
+    }
+    {
+        std::vector<int> a(4);
+        CHECK_THROWS(mv::rotate(mv::memory_view<int>(a.data(), a.size()), 5));
+    }
+
+    // shift_left/shift_right keep the shifted elements and return their view
+    for(std::size_t n = 0; n <= 3; n++){
+        std::vector<int> a{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        const auto left = mv::shift_left(mv::memory_view<int>(a.data(), a.size()), n);
+        CHECK(left.data() == a.data());
+        CHECK(left.size() == a.size() - n);
+        for(std::size_t i = 0; i < left.size(); i++)
+            CHECK(left[i] == static_cast<int>(i + n));
+
+        std::vector<int> b{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        const auto right = mv::shift_right(mv::memory_view<int>(b.data(), b.size()), n);
+        CHECK(right.data() == b.data() + n);
+        CHECK(right.size() == b.size() - n);
+        for(std::size_t i = 0; i < right.size(); i++)
+            CHECK(right[i] == static_cast<int>(i));
+    }
+    {
+        std::vector<int> a(5);
+        CHECK(mv::shift_left(mv::memory_view<int>(a.data(), a.size()), 5).empty());
+        CHECK(mv::shift_right(mv::memory_view<int>(a.data(), a.size()), 9).empty());
+    }
+
+    // copy_within with overlap in both directions, memmove and element wise paths
+    for(std::size_t src = 0; src < 8; src++){
+        for(std::size_t dst = 0; dst < 8; dst++){
+            std::vector<int> a(16), expected(16);
+            std::iota(a.begin(), a.end(), 0);
+            std::iota(expected.begin(), expected.end(), 0);
+            std::vector<int> moved(expected.begin() + static_cast<std::ptrdiff_t>(src),
+                                   expected.begin() + static_cast<std::ptrdiff_t>(src + 8));
+            std::copy(moved.begin(), moved.end(), expected.begin() + static_cast<std::ptrdiff_t>(dst));
+            mv::copy_within(mv::memory_view<int>(a.data(), a.size()), src, 8, dst);
+            CHECK(a == expected);
+
+            std::vector<std::string> s(16);
+            for(std::size_t i = 0; i < s.size(); i++)
+                s[i] = std::to_string(i);
+            mv::copy_within(mv::memory_view<std::string>(s.data(), s.size()), src, 8, dst);
+            for(std::size_t i = 0; i < 8; i++)
+                CHECK(s[dst + i] == std::to_string(src + i));
+        }
+    }
+    {
+        std::vector<int> a(8);
+        CHECK_THROWS(mv::copy_within(mv::memory_view<int>(a.data(), a.size()), 4, 5, 0));
+        CHECK_THROWS(mv::copy_within(mv::memory_view<int>(a.data(), a.size()), 0, 5, 4));
+    }
+
+    // overlaps and move_overlapping between views of different sizes
+    {
+        std::vector<int> a(10);
+        const mv::memory_view<int> v(a.data(), a.size());
+        CHECK(mv::overlaps(v.first(5), v.view(4, 2)));
+        CHECK(!mv::overlaps(v.first(5), v.last(5)));
+        CHECK(!mv::overlaps(v.first(0), v));
+        CHECK_THROWS(mv::move_overlapping(v.first(3), v.last(4)));
+    }
+
+    // fill and fill_nontemporal at every head misalignment and tail length,
+    // guard elements around the view must stay untouched
+    for(std::size_t offset = 0; offset < 8; offset++){
+        for(std::size_t n : {0, 1, 7, 16, 33, 64, 100, 1000, 5000}){
+            std::vector<std::uint32_t> a(n + 16, 0xdeadbeef), b(n + 16, 0xdeadbeef);
+            mv::fill(mv::memory_view<std::uint32_t>(a.data() + offset, n), std::uint32_t{0x01020304});
+            mv::fill_nontemporal(mv::memory_view<std::uint32_t>(b.data() + offset, n), std::uint32_t{0x01020304});
+            for(std::size_t i = 0; i < a.size(); i++){
+                const std::uint32_t expected = i >= offset && i < offset + n ? 0x01020304 : 0xdeadbeef;
+                CHECK(a[i] == expected);
+                CHECK(b[i] == expected);
+            }
+
+            std::vector<unsigned char> c(n + 16, 0xee);
+            mv::fill_nontemporal(mv::memory_view<unsigned char>(c.data() + offset, n), static_cast<unsigned char>(7));
+            for(std::size_t i = 0; i < c.size(); i++)
+                CHECK(c[i] == (i >= offset && i < offset + n ? 7 : 0xee));
+        }
+    }
+    // 3 byte elements do not divide the vector width
+    {
+        struct rgb{ unsigned char r, g, b; };
+        std::vector<rgb> a(1001, rgb{0, 0, 0});
+        mv::fill_nontemporal(mv::memory_view<rgb>(a.data() + 1, 999), rgb{1, 2, 3});
+        CHECK(a[0].r == 0 && a[1000].b == 0);
+        for(std::size_t i = 1; i < 1000; i++)
+            CHECK(a[i].r == 1 && a[i].g == 2 && a[i].b == 3);
+    }
+    {
+        std::vector<std::string> s(5);
+        mv::fill(mv::memory_view<std::string>(s.data() + 1, 3), std::string("abc"));
+        CHECK(s[0].empty() && s[1] == "abc" && s[3] == "abc" && s[4].empty());
+    }
+
+    // fill_pattern against view[i] = pattern[i % size], partial last pattern and
+    // views beyond the replication block
+    for(std::size_t p : {1, 3, 16, 17, 100}){
+        std::vector<std::uint16_t> pattern(p);
+        std::iota(pattern.begin(), pattern.end(), std::uint16_t{1});
+        for(std::size_t n : {0, 1, 2, 15, 16, 17, 99, 2049, 10007}){
+            std::vector<std::uint16_t> a(n + 2, 0xffff);
+            mv::fill_pattern(mv::memory_view<std::uint16_t>(a.data() + 1, n),
+                             mv::memory_view<const std::uint16_t>(pattern.data(), pattern.size()));
+            CHECK(a.front() == 0xffff && a.back() == 0xffff);
+            for(std::size_t i = 0; i < n; i++)
+                CHECK(a[i + 1] == pattern[i % p]);
+
+            // element wise path, the pattern has a different element type
+            std::vector<std::uint32_t> b(n);
+            mv::fill_pattern(mv::memory_view<std::uint32_t>(b.data(), b.size()),
+                             mv::memory_view<const std::uint16_t>(pattern.data(), pattern.size()));
+            for(std::size_t i = 0; i < n; i++)
+                CHECK(b[i] == pattern[i % p]);
+        }
+    }
+    {
+        std::vector<int> a(4);
+        CHECK_THROWS(mv::fill_pattern(mv::memory_view<int>(a.data(), a.size()), mv::memory_view<int>()));
+    }
+
+    return test::result();
+}
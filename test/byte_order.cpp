@@ -0,0 +1,107 @@
+/**
+ * @file   memory_view/test/byte_order.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  bulk byteswap, bit_reverse and shuffle_bytes against a scalar reference
+ */
+#include "test.hpp"
+
+#include <memory_view/byte_order.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    template<typename T>
+    T naive_byteswap(T x){
+        T r = 0;
+        for(std::size_t i = 0; i < sizeof(T); i++, x = static_cast<T>(x >> 8))
+            r = static_cast<T>((r << 8) | (x & 0xFF));
+        return r;
+    }
+
+    template<typename T>
+    T naive_bit_reverse(T x){
+        T r = 0;
+        for(std::size_t i = 0; i < 8 * sizeof(T); i++, x = static_cast<T>(x >> 1))
+            r = static_cast<T>((r << 1) | (x & 1));
+        return r;
+    }
+
+    // every length up to 200 elements, so each vector width ends in every possible tail
+    template<typename T>
+    void check_type(std::mt19937_64& rng){
+        for(std::size_t n = 0; n < 200; n++){
+            std::vector<T> x(n);
+            for(auto& v : x)
+                v = static_cast<T>(rng());
+
+            std::vector<T> swapped(n), reversed(n);
+            mv::byteswap(mv::memory_view<const T>(x.data(), n), mv::memory_view<T>(swapped.data(), n));
+            mv::bit_reverse(mv::memory_view<const T>(x.data(), n), mv::memory_view<T>(reversed.data(), n));
+            for(std::size_t i = 0; i < n; i++){
+                CHECK(swapped[i] == naive_byteswap(x[i]));
+                CHECK(reversed[i] == naive_bit_reverse(x[i]));
+            }
+
+            // in place, at an unaligned start
+            if(n > 0){
+                std::vector<T> y(x);
+                mv::byteswap(mv::memory_view<T>(y.data() + 1, n - 1));
+                CHECK(y[0] == x[0]);
+                for(std::size_t i = 1; i < n; i++)
+                    CHECK(y[i] == naive_byteswap(x[i]));
+                mv::bit_reverse(mv::memory_view<T>(y.data() + 1, n - 1));
+                for(std::size_t i = 1; i < n; i++)
+                    CHECK(y[i] == naive_bit_reverse(naive_byteswap(x[i])));
+            }
+        }
+    }
+}
+
+int main(){
+    std::mt19937_64 rng(94);
+    check_type<std::uint8_t>(rng);
+    check_type<std::uint16_t>(rng);
+    check_type<std::uint32_t>(rng);
+    check_type<std::uint64_t>(rng);
+
+    // byteswap twice is the identity, byte wise view of a 4 byte swap
+    {
+        std::vector<std::uint32_t> x{0x01020304, 0xA0B0C0D0};
+        mv::byteswap(mv::memory_view<std::uint32_t>(x.data(), x.size()));
+        CHECK(x[0] == 0x04030201 && x[1] == 0xD0C0B0A0);
+        mv::byteswap(mv::memory_view<std::uint32_t>(x.data(), x.size()));
+        CHECK(x[0] == 0x01020304 && x[1] == 0xA0B0C0D0);
+    }
+
+    // rgba -> bgra on byte views with tails, pattern against the group index
+    for(std::size_t pixels = 0; pixels < 70; pixels++){
+        std::vector<unsigned char> rgba(4 * pixels), bgra(4 * pixels);
+        for(std::size_t i = 0; i < rgba.size(); i++)
+            rgba[i] = static_cast<unsigned char>(i * 7 + 3);
+        mv::shuffle_bytes<2, 1, 0, 3>(mv::memory_view<const unsigned char>(rgba.data(), rgba.size()),
+                                      mv::memory_view<unsigned char>(bgra.data(), bgra.size()));
+        for(std::size_t p = 0; p < pixels; p++){
+            CHECK(bgra[4 * p + 0] == rgba[4 * p + 2]);
+            CHECK(bgra[4 * p + 1] == rgba[4 * p + 1]);
+            CHECK(bgra[4 * p + 2] == rgba[4 * p + 0]);
+            CHECK(bgra[4 * p + 3] == rgba[4 * p + 3]);
+        }
+        mv::shuffle_bytes<2, 1, 0, 3>(mv::memory_view<unsigned char>(bgra.data(), bgra.size()));
+        CHECK(bgra == rgba);
+    }
+
+    {
+        std::vector<std::uint16_t> a(3), b(4);
+        CHECK_THROWS(mv::byteswap(mv::memory_view<std::uint16_t>(a.data(), a.size()),
+                                  mv::memory_view<std::uint16_t>(b.data(), b.size())));
+        std::vector<unsigned char> c(6);
+        CHECK_THROWS((mv::shuffle_bytes<1, 0, 3, 2>(mv::memory_view<unsigned char>(c.data(), c.size()))));
+    }
+
+    return test::result();
+}
@@ -0,0 +1,103 @@
+/**
+ * @file   memory_view/test/convolution.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  convolutions against a naive reference
+ */
+#include "test.hpp"
+
+#include <memory_view/convolution.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937 rng(83);
+
+    std::vector<float> random_vector(std::size_t n){
+        std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+        std::vector<float> v(n);
+        for(auto& x : v)
+            x = d(rng);
+        return v;
+    }
+
+    void check_convolve_valid(std::size_t n, std::size_t taps){
+        const auto x = random_vector(n);
+        const auto h = random_vector(taps);
+        std::vector<float> y(n - taps + 1);
+        mv::convolve_valid(mv::memory_view<const float>(x), mv::memory_view<const float>(h), mv::memory_view<float>(y));
+        for(std::size_t i = 0; i < y.size(); i++){
+            double sum = 0.0;
+            for(std::size_t k = 0; k < taps; k++)
+                sum += static_cast<double>(h[k]) * static_cast<double>(x[i + taps - 1 - k]);
+            CHECK(std::fabs(static_cast<double>(y[i]) - sum) <= 1e-4 * std::sqrt(static_cast<double>(taps)));
+        }
+    }
+
+    // dst[r][c] = sum(ky[i] * kx[j] * src[clamp(r + cy - i)][clamp(c + cx - j)]), both kernels centered at size / 2
+    void check_separable(std::size_t rows, std::size_t cols, std::size_t nx, std::size_t ny){
+        const auto src = random_vector(rows * cols);
+        const auto kx = random_vector(nx);
+        const auto ky = random_vector(ny);
+        std::vector<float> dst(rows * cols);
+        mv::separable_convolve(mv::matrix_view<const float>(src.data(), rows, cols), mv::memory_view<const float>(kx),
+                               mv::memory_view<const float>(ky), mv::matrix_view<float>(dst.data(), rows, cols));
+
+        const auto clamp = [](std::size_t base, std::size_t center, std::size_t k, std::size_t size){
+            return base + center < k ? 0 : std::min(base + center - k, size - 1);
+        };
+        for(std::size_t r = 0; r < rows; r++){
+            for(std::size_t c = 0; c < cols; c++){
+                double sum = 0.0;
+                for(std::size_t i = 0; i < ny; i++)
+                    for(std::size_t j = 0; j < nx; j++)
+                        sum += static_cast<double>(ky[i]) * static_cast<double>(kx[j]) *
+                            static_cast<double>(src[clamp(r, ny / 2, i, rows) * cols + clamp(c, nx / 2, j, cols)]);
+                CHECK(std::fabs(static_cast<double>(dst[r * cols + c]) - sum) <= 1e-4);
+            }
+        }
+    }
+}
+
+int main(){
+    for(std::size_t taps : {1, 2, 3, 8, 31, 63, 64, 65, 200})
+        for(std::size_t n : {taps, taps + 1, taps + 100, taps + 1000})
+            check_convolve_valid(n, taps);
+
+    for(std::size_t k : {1, 2, 3, 4, 5})
+        check_separable(9, 13, k, 6 - k);
+    check_separable(1, 1, 3, 3);
+    check_separable(40, 70, 7, 4);
+
+    // an impulse is moved the same way along both axes by even kernels
+    {
+        std::vector<float> src(5 * 5, 0.0f), dst(5 * 5);
+        src[2 * 5 + 2] = 1.0f;
+        const float k[] = {1.0f, 0.0f};
+        mv::separable_convolve(mv::matrix_view<const float>(src.data(), 5, 5), mv::memory_view<const float>(k),
+                               mv::memory_view<const float>(k), mv::matrix_view<float>(dst.data(), 5, 5));
+        CHECK(dst[1 * 5 + 1] == 1.0f);
+        CHECK(std::count(dst.begin(), dst.end(), 0.0f) == 24);
+    }
+
+    // the fir filter over batches equals one convolution over the whole signal
+    {
+        const auto taps = random_vector(17);
+        const auto x = random_vector(500);
+        std::vector<float> padded(16, 0.0f), expected(500), y(500);
+        padded.insert(padded.end(), x.begin(), x.end());
+        mv::convolve_valid(mv::memory_view<const float>(padded), mv::memory_view<const float>(taps), mv::memory_view<float>(expected));
+        mv::fir_filter filter(mv::memory_view<const float>(taps.data(), taps.size()));
+        for(std::size_t i = 0; i < 500; i += 100)
+            filter.process(mv::memory_view<const float>(x.data() + i, 100), mv::memory_view<float>(y.data() + i, 100));
+        for(std::size_t i = 0; i < 500; i++)
+            CHECK(std::fabs(y[i] - expected[i]) <= 1e-5f);
+    }
+
+    return test::result();
+}
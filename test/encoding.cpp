@@ -0,0 +1,154 @@
+/**
+ * @file   memory_view/test/encoding.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  run length and dictionary encoding round trips
+ */
+#include "test.hpp"
+
+#include <memory_view/encoding.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937 rng(95);
+
+    // runs of random length over a few distinct values
+    template<typename T>
+    std::vector<T> low_cardinality(std::size_t n, unsigned distinct){
+        std::vector<T> v(n);
+        T value{};
+        for(auto& x : v){
+            if(rng() % 13 == 0)
+                value = static_cast<T>(rng() % distinct);
+            x = value;
+        }
+        return v;
+    }
+
+    template<typename T>
+    void check_rle(const std::vector<T>& in){
+        const std::size_t n = in.size();
+        std::vector<T> values(mv::rle_runs(mv::memory_view<const T>(in)));
+        std::vector<std::uint32_t> lengths(values.size());
+        const std::size_t runs = mv::rle_encode(mv::memory_view<const T>(in), mv::memory_view<T>(values),
+                                                mv::memory_view<std::uint32_t>(lengths));
+        CHECK(runs == values.size());
+        for(std::size_t r = 1; r < runs; r++)
+            CHECK(!(values[r] == values[r - 1]));
+
+        std::vector<T> out(n);
+        CHECK(mv::rle_decode(mv::memory_view<T>(values), mv::memory_view<std::uint32_t>(lengths), mv::memory_view<T>(out)) == n);
+        CHECK(out == in);
+
+        const T wanted = n ? in[n / 2] : T{};
+        const auto pred = [&](const T& x){ return x == wanted; };
+        const std::size_t expected = static_cast<std::size_t>(std::count(in.begin(), in.end(), wanted));
+        CHECK(mv::rle_count_if(mv::memory_view<T>(values), mv::memory_view<std::uint32_t>(lengths), pred) == expected);
+
+        std::vector<std::size_t> positions(n);
+        const std::size_t selected = mv::rle_select_if(mv::memory_view<T>(values), mv::memory_view<std::uint32_t>(lengths), pred,
+                                                       mv::memory_view<std::size_t>(positions));
+        CHECK(selected == expected);
+        for(std::size_t i = 0; i < selected; i++)
+            CHECK(in[positions[i]] == wanted);
+
+        if(runs > 0)
+            CHECK_THROWS(mv::rle_encode(mv::memory_view<const T>(in), mv::memory_view<T>(values).first(runs - 1),
+                                        mv::memory_view<std::uint32_t>(lengths)));
+    }
+
+    template<typename T>
+    void check_dictionary(const std::vector<T>& in, std::size_t distinct){
+        const std::size_t n = in.size();
+        std::vector<T> dictionary(distinct);
+        std::vector<std::uint64_t> words(mv::packed_words(n, mv::dictionary_bits(distinct)));
+        mv::memory_view<std::uint64_t> packed(words);
+
+        const auto [size, bits] = mv::dictionary_encode(mv::memory_view<const T>(in), mv::memory_view<T>(dictionary), packed);
+        CHECK(size <= distinct);
+        CHECK(bits == mv::dictionary_bits(size));
+
+        // the mutable view written by dictionary_encode is decoded directly
+        std::vector<T> out(n);
+        mv::dictionary_decode(mv::memory_view<T>(dictionary).first(size), packed, bits, mv::memory_view<T>(out));
+        CHECK(out == in);
+
+        const T wanted = n ? in[n / 3] : T{};
+        const auto pred = [&](const T& x){ return x == wanted; };
+        const std::size_t expected = static_cast<std::size_t>(std::count(in.begin(), in.end(), wanted));
+        const mv::memory_view<const std::uint64_t> cpacked(packed);
+        CHECK(mv::dictionary_count_if(mv::memory_view<T>(dictionary).first(size), cpacked, bits, n, pred) == expected);
+
+        std::vector<std::size_t> positions(n);
+        const std::size_t selected = mv::dictionary_select_if(mv::memory_view<T>(dictionary).first(size), packed, bits, n, pred,
+                                                              mv::memory_view<std::size_t>(positions));
+        CHECK(selected == expected);
+        for(std::size_t i = 0; i < selected; i++)
+            CHECK(in[positions[i]] == wanted);
+    }
+
+    template<typename T>
+    void check_type(unsigned distinct){
+        for(std::size_t n : {0, 1, 2, 15, 16, 17, 31, 32, 33, 64, 1000, 100000}){
+            const auto in = low_cardinality<T>(n, distinct);
+            check_rle(in);
+            check_dictionary(in, distinct);
+        }
+    }
+}
+
+int main(){
+    check_type<std::uint8_t>(7);
+    check_type<std::uint16_t>(5);
+    check_type<std::int16_t>(300);
+    check_type<std::uint32_t>(3);
+    check_type<std::int64_t>(70000);
+    check_type<float>(9);
+
+    // a single run spanning many vectors
+    check_rle(std::vector<std::uint16_t>(50000, 7));
+
+    // bool has no unsigned counterpart for the flat code table
+    {
+        const bool flags[] = {true, true, false, true, false, false};
+        bool dictionary[2];
+        std::uint64_t word = 0;
+        const auto [size, bits] = mv::dictionary_encode(mv::memory_view<const bool>(flags), mv::memory_view<bool>(dictionary),
+                                                        mv::memory_view<std::uint64_t>(&word, 1));
+        CHECK(size == 2 && bits == 1 && word == 0b110100);
+        bool out[6];
+        mv::dictionary_decode(mv::memory_view<bool>(dictionary, size), mv::memory_view<std::uint64_t>(&word, 1), bits,
+                              mv::memory_view<bool>(out));
+        CHECK(std::equal(out, out + 6, flags));
+    }
+
+    // an index outside of the dictionary is rejected by decode and by the predicates
+    {
+        const std::uint16_t dictionary[] = {10, 20, 30};
+        // codes 0, 2, 3, 1 at 2 bits each
+        const std::uint64_t word = 0b01111000;
+        const mv::memory_view<const std::uint64_t> packed(&word, 1);
+        const auto pred = [](std::uint16_t x){ return x == 10; };
+        std::uint16_t out[4];
+        std::size_t positions[4];
+        CHECK_THROWS(mv::dictionary_decode(mv::memory_view<const std::uint16_t>(dictionary), packed, 2, mv::memory_view<std::uint16_t>(out)));
+        CHECK_THROWS(mv::dictionary_count_if(mv::memory_view<const std::uint16_t>(dictionary), packed, 2, 4, pred));
+        CHECK_THROWS(mv::dictionary_select_if(mv::memory_view<const std::uint16_t>(dictionary), packed, 2, 4, pred,
+                                              mv::memory_view<std::size_t>(positions)));
+        // the values before the invalid index are fine
+        CHECK(mv::dictionary_count_if(mv::memory_view<const std::uint16_t>(dictionary), packed, 2, 2, pred) == 1);
+    }
+
+    std::vector<std::string> strings = {"ok", "ok", "error", "ok", "warning", "error"};
+    check_rle(strings);
+    check_dictionary(strings, 3);
+
+    return test::result();
+}
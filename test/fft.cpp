@@ -0,0 +1,88 @@
+/**
+ * @file   memory_view/test/fft.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  fft_plan and rfft_plan against a naive DFT
+ */
+#include "test.hpp"
+
+#include <memory_view/fft.hpp>
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937 rng(84);
+
+    std::vector<std::complex<double>> dft(const std::vector<std::complex<float>>& x){
+        const double pi = std::acos(-1.0);
+        const std::size_t n = x.size();
+        std::vector<std::complex<double>> y(n);
+        for(std::size_t k = 0; k < n; k++)
+            for(std::size_t j = 0; j < n; j++)
+                y[k] += std::complex<double>(x[j]) * std::polar(1.0, -2.0 * pi * static_cast<double>(j * k % n) / static_cast<double>(n));
+        return y;
+    }
+
+    bool close(std::complex<float> a, std::complex<double> b, double tolerance){
+        return std::abs(std::complex<double>(a) - b) <= tolerance;
+    }
+
+    void check_fft(std::size_t n){
+        std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+        std::vector<std::complex<float>> x(n), y(n);
+        for(auto& v : x)
+            v = {d(rng), d(rng)};
+        const auto expected = dft(x);
+        const double tolerance = 1e-4 * std::sqrt(static_cast<double>(n)) * std::log2(static_cast<double>(n) + 1.0);
+
+        const mv::fft_plan plan(n);
+        plan.forward(mv::memory_view<const std::complex<float>>(x.data(), n), mv::memory_view<std::complex<float>>(y.data(), n));
+        for(std::size_t k = 0; k < n; k++)
+            CHECK(close(y[k], expected[k], tolerance));
+
+        // in place inverse, not scaled
+        plan.inverse(mv::memory_view<std::complex<float>>(y.data(), n));
+        for(std::size_t k = 0; k < n; k++)
+            CHECK(close(y[k], std::complex<double>(x[k]) * static_cast<double>(n), tolerance * static_cast<double>(n)));
+    }
+
+    void check_rfft(std::size_t n){
+        std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+        std::vector<float> x(n), back(n);
+        std::vector<std::complex<float>> xc(n), y(n / 2 + 1);
+        for(std::size_t i = 0; i < n; i++)
+            xc[i] = x[i] = d(rng);
+        const auto expected = dft(xc);
+        const double tolerance = 1e-4 * std::sqrt(static_cast<double>(n)) * std::log2(static_cast<double>(n) + 1.0);
+
+        mv::rfft_plan plan(n);
+        plan.forward(mv::memory_view<const float>(x.data(), n), mv::memory_view<std::complex<float>>(y.data(), y.size()));
+        for(std::size_t k = 0; k <= n / 2; k++)
+            CHECK(close(y[k], expected[k], tolerance));
+
+        plan.inverse(mv::memory_view<const std::complex<float>>(y.data(), y.size()), mv::memory_view<float>(back.data(), n));
+        for(std::size_t i = 0; i < n; i++)
+            CHECK(std::fabs(static_cast<double>(back[i]) - static_cast<double>(x[i]) * static_cast<double>(n)) <=
+                  tolerance * static_cast<double>(n));
+    }
+}
+
+int main(){
+    for(std::size_t n = 1; n <= 2048; n *= 2)
+        check_fft(n);
+    for(std::size_t n = 2; n <= 2048; n *= 2)
+        check_rfft(n);
+
+    for(std::size_t n : {0, 3, 6, 12, 1000})
+        CHECK_THROWS(mv::fft_plan(n));
+    // odd sizes have a power of two half, they must be rejected before it is planned
+    for(std::size_t n : {0, 1, 3, 5, 6, 9, 17, 33, 100})
+        CHECK_THROWS(mv::rfft_plan(n));
+
+    return test::result();
+}
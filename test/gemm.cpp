@@ -0,0 +1,108 @@
+/**
+ * @file   memory_view/test/gemm.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  gemm and gemv against a naive reference
+ */
+#include "test.hpp"
+
+#include <memory_view/gemm.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937 rng(82);
+
+    std::vector<float> random_vector(std::size_t n){
+        std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+        std::vector<float> v(n);
+        for(auto& x : v)
+            x = d(rng);
+        return v;
+    }
+
+    // c = alpha * a * b + beta * c on strided views (lda, ldb, ldc >= the column counts)
+    void check_gemm(std::size_t m, std::size_t n, std::size_t k, float alpha, float beta,
+                    std::size_t pad, std::size_t threads){
+        const std::size_t lda = k + pad, ldb = n + pad, ldc = n + pad;
+        const auto a = random_vector(m * lda);
+        const auto b = random_vector(k * ldb);
+        auto c = random_vector(m * ldc);
+
+        std::vector<double> expected(m * n);
+        for(std::size_t i = 0; i < m; i++){
+            for(std::size_t j = 0; j < n; j++){
+                double sum = 0.0;
+                for(std::size_t p = 0; p < k; p++)
+                    sum += static_cast<double>(a[i * lda + p]) * static_cast<double>(b[p * ldb + j]);
+                expected[i * n + j] = static_cast<double>(alpha) * sum +
+                    (beta == 0.0f ? 0.0 : static_cast<double>(beta) * static_cast<double>(c[i * ldc + j]));
+            }
+        }
+
+        mv::gemm(alpha, mv::matrix_view<const float>(a.data(), m, k, lda), mv::matrix_view<const float>(b.data(), k, n, ldb),
+                 beta, mv::matrix_view<float>(c.data(), m, n, ldc), threads);
+
+        const double tolerance = 1e-5 * static_cast<double>(k + 1);
+        for(std::size_t i = 0; i < m; i++)
+            for(std::size_t j = 0; j < n; j++)
+                CHECK(std::fabs(static_cast<double>(c[i * ldc + j]) - expected[i * n + j]) <= tolerance);
+    }
+
+    void check_gemv(std::size_t m, std::size_t n, float alpha, float beta, std::size_t threads){
+        const auto a = random_vector(m * n);
+        const auto x = random_vector(n);
+        auto y = random_vector(m);
+
+        std::vector<double> expected(m);
+        for(std::size_t i = 0; i < m; i++){
+            double sum = 0.0;
+            for(std::size_t j = 0; j < n; j++)
+                sum += static_cast<double>(a[i * n + j]) * static_cast<double>(x[j]);
+            expected[i] = static_cast<double>(alpha) * sum +
+                (beta == 0.0f ? 0.0 : static_cast<double>(beta) * static_cast<double>(y[i]));
+        }
+
+        mv::gemv(alpha, mv::matrix_view<const float>(a.data(), m, n), mv::memory_view<const float>(x.data(), n),
+                 beta, mv::memory_view<float>(y.data(), m), threads);
+
+        for(std::size_t i = 0; i < m; i++)
+            CHECK(std::fabs(static_cast<double>(y[i]) - expected[i]) <= 1e-5 * static_cast<double>(n + 1));
+    }
+}
+
+int main(){
+    // sizes around the microkernel and blocking sizes
+    const std::size_t sizes[] = {1, 3, 5, 6, 7, 8, 15, 16, 17, 33, 97, 150, 300};
+    for(std::size_t m : sizes)
+        for(std::size_t n : {std::size_t{1}, std::size_t{9}, std::size_t{32}, std::size_t{65}})
+            for(std::size_t k : {std::size_t{1}, std::size_t{7}, std::size_t{64}, std::size_t{257}})
+                check_gemm(m, n, k, 1.0f, 0.0f, 0, 1);
+
+    check_gemm(129, 531, 300, 0.5f, -2.0f, 3, 1);
+    check_gemm(129, 531, 300, 0.5f, -2.0f, 3, 4);
+    check_gemm(600, 40, 20, 1.0f, 1.0f, 0, 3);
+
+    // k == 0 leaves beta * c
+    check_gemm(2, 2, 0, 1.0f, 0.0f, 0, 1);
+    check_gemm(5, 3, 0, 1.0f, 2.0f, 1, 2);
+    {
+        float c[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+        mv::gemm(1.0f, mv::matrix_view<const float>(nullptr, 2, 0), mv::matrix_view<const float>(nullptr, 0, 2),
+                 0.0f, mv::matrix_view<float>(c, 2, 2));
+        CHECK(c[0] == 0.0f && c[1] == 0.0f && c[2] == 0.0f && c[3] == 0.0f);
+    }
+
+    CHECK_THROWS(mv::gemm(1.0f, mv::matrix_view<const float>(nullptr, 2, 3), mv::matrix_view<const float>(nullptr, 2, 2),
+                          0.0f, mv::matrix_view<float>(nullptr, 2, 2)));
+
+    for(std::size_t m : {1, 7, 100, 1000})
+        for(std::size_t n : {0, 1, 15, 16, 17, 300})
+            check_gemv(m, n, 2.0f, 0.5f, 2);
+
+    return test::result();
+}
@@ -0,0 +1,125 @@
+/**
+ * @file   memory_view/test/image_view.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  image conversions against a per pixel reference
+ */
+#include "test.hpp"
+
+#include <memory_view/image_view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937 rng(85);
+
+    std::vector<std::uint8_t> random_bytes(std::size_t n){
+        std::uniform_int_distribution<int> d(0, 255);
+        std::vector<std::uint8_t> v(n);
+        for(auto& x : v)
+            x = static_cast<std::uint8_t>(d(rng));
+        return v;
+    }
+
+    int clamp_u8(int v){
+        return std::clamp(v, 0, 255);
+    }
+
+    template<std::size_t N>
+    void check_planes(std::size_t width, std::size_t height, std::size_t pitch){
+        const auto pixels = random_bytes(pitch * height);
+        const mv::pixel_format format = N == 3 ? mv::pixel_format::rgb24 : mv::pixel_format::rgba32;
+        const mv::image_view<const std::uint8_t> src(mv::memory_view<const std::uint8_t>(pixels), format, width, height, pitch);
+
+        std::vector<std::vector<std::uint8_t>> storage(N, std::vector<std::uint8_t>(width * height));
+        std::array<mv::matrix_view<std::uint8_t>, N> planes;
+        std::array<mv::matrix_view<const std::uint8_t>, N> const_planes;
+        for(std::size_t c = 0; c < N; c++){
+            planes[c] = mv::matrix_view<std::uint8_t>(storage[c].data(), height, width);
+            const_planes[c] = planes[c];
+        }
+        mv::deinterleave(src, planes);
+        for(std::size_t y = 0; y < height; y++)
+            for(std::size_t x = 0; x < width; x++)
+                for(std::size_t c = 0; c < N; c++)
+                    CHECK(planes[c](y, x) == pixels[y * pitch + x * N + c]);
+
+        // the padding at the end of the rows is left alone
+        std::vector<std::uint8_t> merged(pitch * height, 7);
+        mv::interleave(const_planes, mv::image_view<std::uint8_t>(mv::memory_view<std::uint8_t>(merged), format, width, height, pitch));
+        for(std::size_t y = 0; y < height; y++)
+            for(std::size_t i = 0; i < pitch; i++)
+                CHECK(merged[y * pitch + i] == (i < width * N ? pixels[y * pitch + i] : 7));
+    }
+
+    void check_yuv(mv::pixel_format format, mv::yuv_matrix matrix, std::size_t width, std::size_t height){
+        const std::size_t ch = mv::channels(format);
+        const auto pixels = random_bytes(width * ch * height);
+        const mv::image_view<const std::uint8_t> src(mv::memory_view<const std::uint8_t>(pixels), format, width, height);
+        const bool bgr = format == mv::pixel_format::bgr24 || format == mv::pixel_format::bgra32;
+        const bool bt709 = matrix == mv::yuv_matrix::bt709;
+
+        std::vector<std::uint8_t> storage(3 * width * height);
+        std::array<mv::matrix_view<std::uint8_t>, 3> yuv;
+        std::array<mv::matrix_view<const std::uint8_t>, 3> const_yuv;
+        for(std::size_t c = 0; c < 3; c++){
+            yuv[c] = mv::matrix_view<std::uint8_t>(storage.data() + c * width * height, height, width);
+            const_yuv[c] = yuv[c];
+        }
+        mv::rgb_to_yuv(src, yuv, matrix);
+
+        for(std::size_t y = 0; y < height; y++){
+            for(std::size_t x = 0; x < width; x++){
+                const std::uint8_t* p = pixels.data() + (y * width + x) * ch;
+                const int r = p[bgr ? 2 : 0], g = p[1], b = p[bgr ? 0 : 2];
+                const int ey = bt709 ? (47 * r + 157 * g + 16 * b + 4224) >> 8 : (66 * r + 129 * g + 25 * b + 4224) >> 8;
+                const int eu = bt709 ? (-26 * r - 87 * g + 112 * b + 32896) >> 8 : (-38 * r - 74 * g + 112 * b + 32896) >> 8;
+                const int ev = bt709 ? (112 * r - 102 * g - 10 * b + 32896) >> 8 : (112 * r - 94 * g - 18 * b + 32896) >> 8;
+                CHECK(yuv[0](y, x) == ey);
+                CHECK(yuv[1](y, x) == eu);
+                CHECK(yuv[2](y, x) == ev);
+            }
+        }
+
+        // back from random planes, which also covers values outside of the limited range
+        const auto planes = random_bytes(3 * width * height);
+        std::copy(planes.begin(), planes.end(), storage.begin());
+        std::vector<std::uint8_t> out(width * ch * height, 0);
+        mv::yuv_to_rgb(const_yuv, mv::image_view<std::uint8_t>(mv::memory_view<std::uint8_t>(out), format, width, height), matrix);
+        for(std::size_t y = 0; y < height; y++){
+            for(std::size_t x = 0; x < width; x++){
+                const int c = 298 * (yuv[0](y, x) - 16) + 128;
+                const int d = yuv[1](y, x) - 128;
+                const int e = yuv[2](y, x) - 128;
+                const int r = clamp_u8((c + (bt709 ? 459 : 409) * e) >> 8);
+                const int g = clamp_u8((c + (bt709 ? -55 : -100) * d + (bt709 ? -136 : -208) * e) >> 8);
+                const int b = clamp_u8((c + (bt709 ? 541 : 516) * d) >> 8);
+                const std::uint8_t* q = out.data() + (y * width + x) * ch;
+                CHECK(q[bgr ? 2 : 0] == r);
+                CHECK(q[1] == g);
+                CHECK(q[bgr ? 0 : 2] == b);
+                if(ch == 4)
+                    CHECK(q[3] == 255);
+            }
+        }
+    }
+}
+
+int main(){
+    for(std::size_t width : {1, 15, 16, 17, 33, 100}){
+        check_planes<3>(width, 5, width * 3);
+        check_planes<3>(width, 5, width * 3 + 5);
+        check_planes<4>(width, 5, width * 4);
+        check_planes<4>(width, 5, width * 4 + 3);
+        for(auto format : {mv::pixel_format::rgb24, mv::pixel_format::bgr24, mv::pixel_format::rgba32, mv::pixel_format::bgra32})
+            for(auto matrix : {mv::yuv_matrix::bt601, mv::yuv_matrix::bt709})
+                check_yuv(format, matrix, width, 4);
+    }
+
+    return test::result();
+}
@@ -0,0 +1,75 @@
+/**
+ * @file   memory_view/test/matrix_view.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  tiled transpose and strided copy
+ */
+#include "test.hpp"
+
+#include <memory_view/matrix_view.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    // strided source and destination with padding which must stay untouched
+    template<typename T>
+    void check_transpose(std::size_t rows, std::size_t cols){
+        const std::size_t src_stride = cols + 3;
+        const std::size_t dst_stride = rows + 5;
+        std::vector<T> src(rows * src_stride);
+        for(std::size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<T>(i % 251);
+        std::vector<T> dst(cols * dst_stride, T{7});
+
+        mv::transpose(mv::matrix_view<const T>(src.data(), rows, cols, src_stride),
+                      mv::matrix_view<T>(dst.data(), cols, rows, dst_stride));
+        for(std::size_t c = 0; c < cols; c++)
+            for(std::size_t r = 0; r < dst_stride; r++)
+                CHECK(dst[c * dst_stride + r] == (r < rows ? src[r * src_stride + c] : T{7}));
+    }
+
+    template<typename T>
+    void check_copy(std::size_t rows, std::size_t cols, std::size_t src_stride, std::size_t dst_stride){
+        std::vector<T> src(rows * src_stride);
+        for(std::size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<T>(i % 127);
+        std::vector<T> dst(rows * dst_stride, T{1});
+        mv::copy(mv::matrix_view<const T>(src.data(), rows, cols, src_stride),
+                 mv::matrix_view<T>(dst.data(), rows, cols, dst_stride));
+        for(std::size_t r = 0; r < rows; r++)
+            for(std::size_t c = 0; c < dst_stride; c++)
+                CHECK(dst[r * dst_stride + c] == (c < cols ? src[r * src_stride + c] : T{1}));
+    }
+}
+
+int main(){
+    // around the 4x4 SSE kernel and the tile edges
+    for(std::size_t rows : {1, 3, 4, 5, 31, 32, 33, 67})
+        for(std::size_t cols : {1, 4, 7, 32, 65}){
+            check_transpose<float>(rows, cols);
+            check_transpose<std::int32_t>(rows, cols);
+            check_transpose<double>(rows, cols);
+            check_transpose<std::uint8_t>(rows, cols);
+            check_transpose<std::int16_t>(rows, cols);
+        }
+    check_transpose<float>(203, 199);
+
+    for(std::size_t rows : {0, 1, 9})
+        for(std::size_t cols : {1, 13}){
+            check_copy<float>(rows, cols, cols, cols);
+            check_copy<float>(rows, cols, cols + 2, cols);
+            check_copy<double>(rows, cols, cols, cols + 4);
+        }
+
+    {
+        float a[6] = {};
+        float b[6] = {};
+        CHECK_THROWS(mv::transpose(mv::matrix_view<const float>(a, 2, 3), mv::matrix_view<float>(b, 2, 3)));
+        CHECK_THROWS(mv::copy(mv::matrix_view<const float>(a, 2, 3), mv::matrix_view<float>(b, 3, 2)));
+    }
+
+    return test::result();
+}
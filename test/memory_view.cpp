@@ -0,0 +1,41 @@
+/**
+ * @file   memory_view/test/memory_view.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  comparisons between views with different checking policies
+ */
+#include "test.hpp"
+
+#include <memory_view.hpp>
+
+#include <vector>
+
+namespace mv = memory_view;
+
+int main(){
+    std::vector<int> a{1, 2, 3}, b{1, 2, 4}, c{1, 2};
+
+    const mv::unchecked_view<int> ua(a), ub(b), uc(c);
+    const mv::checked_view<int>   ca(a), cb(b), cc(c);
+    const mv::hardened_view<int>  ha(a);
+
+    // equal elements compare equal whatever the policy
+    CHECK(ua == ca && ca == ua && ha == ca && ua == ha);
+    CHECK(!(ua != ca) && !(ha != ua));
+    CHECK(ua != cb && cb != ua);
+    CHECK(ua != cc && cc != ua);
+
+    // lexicographical order, a shorter prefix is less
+    CHECK(ua < cb && !(cb < ua));
+    CHECK(cb > ua && !(ua > cb));
+    CHECK(uc < ca && cc < ua);
+    CHECK(ua <= ca && ua >= ca && ca <= ub && cb >= ua);
+    CHECK(!(cb <= ua) && !(ua >= cb));
+
+    // same policy and empty views
+    CHECK(ua == mv::unchecked_view<int>(a));
+    CHECK(mv::checked_view<int>() == mv::unchecked_view<int>());
+    CHECK(mv::checked_view<int>() < ua);
+
+    return test::result();
+}
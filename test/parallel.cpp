@@ -0,0 +1,51 @@
+/**
+ * @file   memory_view/test/parallel.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  chunking and exceptions of parallel_for
+ */
+#include "test.hpp"
+
+#include <memory_view/parallel.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace mv = memory_view;
+
+int main(){
+    // every index is visited once, the chunks are multiples of grain
+    for(std::size_t threads : {1, 2, 3, 8}){
+        for(std::size_t n : {0, 1, 7, 100, 1001}){
+            std::vector<std::atomic<int>> visits(n);
+            mv::parallel_for(n, threads, [&](std::size_t begin, std::size_t end){
+                CHECK(begin % 16 == 0);
+                CHECK(end % 16 == 0 || end == n);
+                for(std::size_t i = begin; i < end; i++)
+                    visits[i]++;
+            }, 16);
+            for(const auto& v : visits)
+                CHECK(v == 1);
+        }
+    }
+
+    // exceptions on the calling thread and on the workers reach the caller after all threads are joined
+    for(std::size_t thrower : {0, 1, 3}){
+        std::atomic<int> finished{0};
+        bool caught = false;
+        try{
+            mv::parallel_for(4, 4, [&](std::size_t begin, std::size_t){
+                if(begin == thrower)
+                    throw std::runtime_error("chunk");
+                finished++;
+            });
+        }catch(const std::runtime_error&){
+            caught = true;
+        }
+        CHECK(caught);
+        CHECK(finished == 3);
+    }
+
+    return test::result();
+}
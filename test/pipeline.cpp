@@ -0,0 +1,81 @@
+/**
+ * @file   memory_view/test/pipeline.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  fused pipelines against plain loops
+ */
+#include "test.hpp"
+
+#include <memory_view/pipeline.hpp>
+
+#include <numeric>
+#include <vector>
+
+namespace mv = memory_view;
+
+int main(){
+    std::vector<int> a(10000), b(10000);
+    std::iota(a.begin(), a.end(), -5000);
+    std::iota(b.begin(), b.end(), 0);
+    const mv::memory_view<const int> va(a.data(), a.size());
+    const mv::memory_view<const int> vb(b.data(), b.size());
+
+    // map and filter over two views
+    {
+        std::vector<long> expected;
+        for(std::size_t i = 0; i < a.size(); i++)
+            if(a[i] * 3 + b[i] > 0)
+                expected.push_back(2L * (a[i] * 3 + b[i]));
+        std::vector<long> out(a.size());
+        const std::size_t n = mv::from(va, vb)
+            .map([](int x, int y){ return x * 3 + y; })
+            .filter([](int v){ return v > 0; })
+            .map([](int v){ return 2L * v; })
+            .collect_into(mv::memory_view<long>(out));
+        CHECK(n == expected.size());
+        CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+    }
+
+    // a dense pipeline writes min(size, out.size()) values
+    {
+        std::vector<int> out(100, -1);
+        CHECK(mv::from(va).map([](int x){ return x + 1; }).collect_into(mv::memory_view<int>(out.data(), 50)) == 50);
+        CHECK(out[49] == a[49] + 1 && out[50] == -1);
+    }
+
+    // no stage runs after the value which filled out
+    for(std::size_t capacity : {0, 1, 7, 4096, 4097}){
+        std::size_t filtered = 0;
+        std::size_t mapped = 0;
+        std::vector<int> out(capacity);
+        const std::size_t n = mv::from(va)
+            .filter([&](int x){ filtered++; return x % 2 == 0; })
+            .map([&](int x){ mapped++; return x; })
+            .collect_into(mv::memory_view<int>(out));
+        CHECK(n == capacity);
+        CHECK(mapped == capacity);
+        CHECK(filtered == (capacity == 0 ? 0 : 2 * capacity - 1));
+        for(std::size_t i = 0; i < n; i++)
+            CHECK(out[i] == a[2 * i]);
+    }
+
+    // enumerate, reduce and for_each
+    {
+        const long sum = mv::from(va, vb)
+            .enumerate()
+            .map([](std::size_t i, int x, int y){ return static_cast<long>(i) * x - y; })
+            .reduce(0L, [](long acc, long v){ return acc + v; });
+        long expected = 0;
+        for(std::size_t i = 0; i < a.size(); i++)
+            expected += static_cast<long>(i) * a[i] - b[i];
+        CHECK(sum == expected);
+
+        std::size_t count = 0;
+        mv::from(va).filter([](int x){ return x < 0; }).for_each([&](int x){ CHECK(x < 0); count++; });
+        CHECK(count == 5000);
+    }
+
+    CHECK_THROWS(mv::from(va, mv::memory_view<const int>(b.data(), 3)));
+
+    return test::result();
+}
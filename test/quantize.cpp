@@ -0,0 +1,88 @@
+/**
+ * @file   memory_view/test/quantize.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  quantized dot products against a scalar int64 reference
+ */
+#include "test.hpp"
+
+#include <memory_view/quantize.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::int64_t reference(const std::vector<std::int8_t>& a, const std::vector<std::int8_t>& b){
+        std::int64_t sum = 0;
+        for(std::size_t i = 0; i < a.size(); i++)
+            sum += static_cast<std::int64_t>(a[i]) * b[i];
+        return sum;
+    }
+
+    // the block dot product against the dequantized values
+    void check_blocks(const std::vector<float>& x, const std::vector<float>& y, std::size_t block_size, bool symmetric){
+        const std::size_t blocks = (x.size() + block_size - 1) / block_size;
+        std::vector<std::int8_t> qa(x.size()), qb(y.size());
+        std::vector<mv::quantization_params> pa(blocks), pb(blocks);
+        mv::quantize(mv::memory_view<const float>(x), mv::memory_view<std::int8_t>(qa), mv::memory_view<mv::quantization_params>(pa), block_size, symmetric);
+        mv::quantize(mv::memory_view<const float>(y), mv::memory_view<std::int8_t>(qb), mv::memory_view<mv::quantization_params>(pb), block_size, symmetric);
+
+        double expected = 0.0;
+        for(std::size_t i = 0; i < x.size(); i++){
+            const mv::quantization_params& p = pa[i / block_size];
+            const mv::quantization_params& q = pb[i / block_size];
+            expected += static_cast<double>((qa[i] - p.zero_point) * (qb[i] - q.zero_point)) *
+                static_cast<double>(p.scale) * static_cast<double>(q.scale);
+        }
+        const float sum = mv::dot(mv::memory_view<const std::int8_t>(qa), mv::memory_view<const mv::quantization_params>(pa),
+                                  mv::memory_view<const std::int8_t>(qb), mv::memory_view<const mv::quantization_params>(pb), block_size);
+        CHECK(std::fabs(static_cast<double>(sum) - expected) <= 1e-4 * (1.0 + std::fabs(expected)));
+    }
+}
+
+int main(){
+    std::mt19937 rng(89);
+    std::uniform_int_distribution<int> d(-128, 127);
+
+    // 524365 is one chunk of SIMD lanes plus a tail
+    for(std::size_t n : {0, 1, 31, 32, 63, 64, 65, 1000, 200000, 524365}){
+        std::vector<std::int8_t> a(n), b(n);
+        for(std::size_t i = 0; i < n; i++){
+            a[i] = static_cast<std::int8_t>(d(rng));
+            b[i] = static_cast<std::int8_t>(d(rng));
+        }
+        CHECK(mv::dot(mv::memory_view<const std::int8_t>(a), mv::memory_view<const std::int8_t>(b)) == reference(a, b));
+    }
+
+    // sums which do not fit into 32 bits, through more than one chunk of SIMD lanes
+    for(std::size_t n : {200000, 3000001}){
+        for(int v : {127, -128}){
+            std::vector<std::int8_t> a(n, static_cast<std::int8_t>(v)), b(n, static_cast<std::int8_t>(v));
+            CHECK(mv::dot(mv::memory_view<const std::int8_t>(a), mv::memory_view<const std::int8_t>(b)) == reference(a, b));
+        }
+        std::vector<std::int8_t> a(n, 127), b(n, -128);
+        CHECK(mv::dot(mv::memory_view<const std::int8_t>(a), mv::memory_view<const std::int8_t>(b)) == reference(a, b));
+    }
+    {
+        std::vector<std::int8_t> a(200000, 127);
+        CHECK(mv::dot(mv::memory_view<const std::int8_t>(a), mv::memory_view<const std::int8_t>(a)) == 3225800000);
+    }
+
+    // per block and per tensor, the per tensor block is large enough to overflow 32 bits
+    {
+        std::uniform_real_distribution<float> f(0.5f, 1.0f);
+        std::vector<float> x(300000), y(300000);
+        for(std::size_t i = 0; i < x.size(); i++){
+            x[i] = f(rng);
+            y[i] = f(rng);
+        }
+        for(bool symmetric : {true, false})
+            for(std::size_t block_size : {32, 1000, 300000, 1000000})
+                check_blocks(x, y, block_size, symmetric);
+    }
+
+    return test::result();
+}
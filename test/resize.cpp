@@ -0,0 +1,79 @@
+/**
+ * @file   memory_view/test/resize.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  8 bit resizing against the float path
+ */
+#include "test.hpp"
+
+#include <memory_view/resize.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    // the 8 bit result is the float result rounded once, up to the fixed point weights
+    void check_against_float(const std::vector<std::uint8_t>& pixels, std::size_t rows, std::size_t cols,
+                             std::size_t out_rows, std::size_t out_cols, std::size_t channels, mv::resize_filter filter){
+        const std::vector<float> values(pixels.begin(), pixels.end());
+        std::vector<std::uint8_t> q(out_rows * out_cols * channels);
+        std::vector<float> f(q.size());
+        mv::resize(mv::matrix_view<const std::uint8_t>(pixels.data(), rows, cols * channels),
+                   mv::matrix_view<std::uint8_t>(q.data(), out_rows, out_cols * channels), filter, channels, 2);
+        mv::resize(mv::matrix_view<const float>(values.data(), rows, cols * channels),
+                   mv::matrix_view<float>(f.data(), out_rows, out_cols * channels), filter, channels);
+        for(std::size_t i = 0; i < q.size(); i++){
+            const float expected = std::fmin(std::fmax(std::nearbyint(f[i]), 0.0f), 255.0f);
+            CHECK(std::fabs(static_cast<float>(q[i]) - expected) <= 1.0f);
+        }
+    }
+}
+
+int main(){
+    const mv::resize_filter filters[] = {mv::resize_filter::bilinear, mv::resize_filter::area, mv::resize_filter::lanczos3};
+
+    // a checkerboard has the largest lanczos overshoot
+    {
+        std::vector<std::uint8_t> board(64 * 64);
+        for(std::size_t y = 0; y < 64; y++)
+            for(std::size_t x = 0; x < 64; x++)
+                board[y * 64 + x] = (x + y) % 2 == 0 ? 255 : 0;
+        for(auto filter : filters){
+            check_against_float(board, 64, 64, 29, 37, 1, filter);
+            check_against_float(board, 64, 64, 101, 150, 1, filter);
+        }
+    }
+
+    {
+        std::mt19937 rng(86);
+        std::uniform_int_distribution<int> d(0, 255);
+        std::vector<std::uint8_t> pixels(40 * 50 * 3);
+        for(auto& p : pixels)
+            p = static_cast<std::uint8_t>(d(rng));
+        for(auto filter : filters){
+            check_against_float(pixels, 40, 50, 17, 23, 3, filter);
+            check_against_float(pixels, 40, 50, 77, 91, 3, filter);
+            check_against_float(pixels, 40, 50, 1, 1, 3, filter);
+        }
+
+        // the same size is a copy for every filter
+        for(auto filter : filters){
+            std::vector<std::uint8_t> q(pixels.size());
+            mv::resize(mv::matrix_view<const std::uint8_t>(pixels.data(), 40, 150),
+                       mv::matrix_view<std::uint8_t>(q.data(), 40, 150), filter, 3);
+            CHECK(q == pixels);
+
+            const std::vector<float> values(pixels.begin(), pixels.end());
+            std::vector<float> f(values.size());
+            mv::resize(mv::matrix_view<const float>(values.data(), 40, 150),
+                       mv::matrix_view<float>(f.data(), 40, 150), filter, 3);
+            for(std::size_t i = 0; i < f.size(); i++)
+                CHECK(std::fabs(f[i] - values[i]) <= 1e-3f);
+        }
+    }
+
+    return test::result();
+}
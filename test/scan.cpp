@@ -0,0 +1,120 @@
+/**
+ * @file   memory_view/test/scan.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  inclusive, exclusive and segmented scans against std::partial_sum
+ */
+#include "test.hpp"
+
+#include <memory_view/scan.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    // out against std::partial_sum of in, serial and with 4 threads
+    template<typename T, typename U>
+    void check_scans(const std::vector<T>& in, U init){
+        const std::size_t n = in.size();
+        // widened first, std::partial_sum accumulates in the input type
+        const std::vector<U> wide(in.begin(), in.end());
+        std::vector<U> inclusive(n), exclusive(n + 1, init);
+        std::partial_sum(wide.begin(), wide.end(), inclusive.begin());
+        for(std::size_t i = 0; i < n; i++)
+            exclusive[i + 1] = static_cast<U>(init + inclusive[i]);
+
+        for(std::size_t threads : {1, 4}){
+            std::vector<U> out(n);
+            const U sum = mv::inclusive_scan(mv::memory_view<const T>(in.data(), n), mv::memory_view<U>(out.data(), n), threads);
+            CHECK(out == inclusive);
+            CHECK(sum == (n ? inclusive.back() : U{}));
+
+            const U total = mv::exclusive_scan(mv::memory_view<const T>(in.data(), n), mv::memory_view<U>(out.data(), n), init, threads);
+            CHECK(std::equal(out.begin(), out.end(), exclusive.begin()));
+            CHECK(total == exclusive.back());
+        }
+    }
+}
+
+int main(){
+    std::mt19937 rng(98);
+    std::uniform_int_distribution<int> d(-100, 100);
+
+    // vector tails, and sizes which split into several parallel chunks
+    for(std::size_t n : {0, 1, 3, 4, 5, 17, 1000, 32768 * 3 + 5, 32768 * 9 + 3}){
+        std::vector<std::int32_t> i32(n);
+        std::vector<std::uint32_t> u32(n);
+        std::vector<float> f32(n);
+        std::vector<std::int64_t> i64(n);
+        std::vector<std::uint8_t> u8(n);
+        for(std::size_t i = 0; i < n; i++){
+            i32[i] = d(rng);
+            u32[i] = static_cast<std::uint32_t>(rng());
+            // small integers keep float sums exact in any order
+            f32[i] = static_cast<float>(d(rng));
+            i64[i] = std::int64_t{d(rng)} << 33;
+            u8[i]  = static_cast<std::uint8_t>(rng());
+        }
+        check_scans(i32, std::int32_t{7});
+        check_scans(u32, std::uint32_t{0xFFFFFFF0u});
+        check_scans(f32, 0.5f);
+        check_scans(i64, std::int64_t{-3});
+        // lengths into 64 bit offsets, element wise path
+        check_scans(u8, std::uint64_t{0});
+    }
+
+    // in place
+    {
+        std::vector<std::int32_t> x(103), expected(103);
+        std::iota(x.begin(), x.end(), 1);
+        std::partial_sum(x.begin(), x.end(), expected.begin());
+        mv::inclusive_scan(mv::memory_view<std::int32_t>(x.data(), x.size()), mv::memory_view<std::int32_t>(x.data(), x.size()));
+        CHECK(x == expected);
+    }
+
+    // segmented scans restart at every flag, every segment against std::partial_sum
+    for(std::size_t n : {0, 1, 2, 50, 1000}){
+        std::vector<std::int32_t> in(n), inclusive(n), exclusive(n);
+        std::vector<std::uint8_t> flags(n);
+        for(std::size_t i = 0; i < n; i++){
+            in[i]    = d(rng);
+            flags[i] = static_cast<std::uint8_t>(i == 0 || rng() % 5 == 0);
+        }
+        // the first element does not need a flag
+        if(n > 1)
+            flags[0] = 0;
+        mv::segmented_inclusive_scan(mv::memory_view<const std::int32_t>(in.data(), n),
+                                     mv::memory_view<const std::uint8_t>(flags.data(), n),
+                                     mv::memory_view<std::int32_t>(inclusive.data(), n));
+        mv::segmented_exclusive_scan(mv::memory_view<const std::int32_t>(in.data(), n),
+                                     mv::memory_view<const std::uint8_t>(flags.data(), n),
+                                     mv::memory_view<std::int32_t>(exclusive.data(), n), std::int32_t{10});
+
+        for(std::size_t begin = 0; begin < n;){
+            std::size_t end = begin + 1;
+            while(end < n && !flags[end])
+                end++;
+            std::vector<std::int32_t> expected(end - begin);
+            std::partial_sum(in.begin() + static_cast<std::ptrdiff_t>(begin), in.begin() + static_cast<std::ptrdiff_t>(end), expected.begin());
+            for(std::size_t i = begin; i < end; i++){
+                CHECK(inclusive[i] == expected[i - begin]);
+                CHECK(exclusive[i] == 10 + expected[i - begin] - in[i]);
+            }
+            begin = end;
+        }
+    }
+
+    {
+        std::vector<std::int32_t> a(3), b(4);
+        CHECK_THROWS(mv::inclusive_scan(mv::memory_view<std::int32_t>(a.data(), a.size()), mv::memory_view<std::int32_t>(b.data(), b.size())));
+        CHECK_THROWS(mv::segmented_inclusive_scan(mv::memory_view<std::int32_t>(a.data(), a.size()),
+                                                  mv::memory_view<std::int32_t>(b.data(), b.size()),
+                                                  mv::memory_view<std::int32_t>(a.data(), a.size())));
+    }
+
+    return test::result();
+}
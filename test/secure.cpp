@@ -0,0 +1,52 @@
+/**
+ * @file   memory_view/test/secure.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  secure_zero and constant_time_equal
+ */
+#include "test.hpp"
+
+#include <memory_view/secure.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace mv = memory_view;
+
+int main(){
+    // a single differing bit at every position, across the SIMD blocks and the tail
+    for(std::size_t n : {0, 1, 15, 16, 17, 31, 32, 33, 100}){
+        std::vector<std::uint8_t> a(n), b(n);
+        for(std::size_t i = 0; i < n; i++)
+            a[i] = b[i] = static_cast<std::uint8_t>(i * 37);
+        const mv::memory_view<const std::uint8_t> va(a.data(), n);
+        CHECK(mv::constant_time_equal(va, mv::memory_view<const std::uint8_t>(b.data(), n)));
+        for(std::size_t i = 0; i < n; i++){
+            b[i] ^= 0x80;
+            CHECK(!mv::constant_time_equal(va, mv::memory_view<const std::uint8_t>(b.data(), n)));
+            b[i] ^= 0x80;
+        }
+        if(n > 0)
+            CHECK(!mv::constant_time_equal(va, mv::memory_view<const std::uint8_t>(b.data(), n - 1)));
+    }
+
+    // the bytes are compared, views of other element types with the same size are equal
+    {
+        const std::uint32_t words[2] = {0x01020304, 0x05060708};
+        std::uint8_t bytes[8];
+        std::memcpy(bytes, words, sizeof(words));
+        CHECK(mv::constant_time_equal(mv::memory_view<const std::uint32_t>(words), mv::memory_view<const std::uint8_t>(bytes)));
+        CHECK(!mv::constant_time_equal(mv::memory_view<const std::uint32_t>(words), mv::memory_view<const std::uint8_t>(bytes, 7)));
+    }
+
+    {
+        std::vector<std::uint64_t> key(37, 0xdeadbeefcafef00d);
+        mv::secure_zero(mv::memory_view<std::uint64_t>(key.data(), 20));
+        for(std::size_t i = 0; i < key.size(); i++)
+            CHECK(key[i] == (i < 20 ? 0 : 0xdeadbeefcafef00d));
+        mv::secure_zero(mv::memory_view<std::uint64_t>());
+    }
+
+    return test::result();
+}
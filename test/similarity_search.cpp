@@ -0,0 +1,86 @@
+/**
+ * @file   memory_view/test/similarity_search.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  top-k search against a brute force sort
+ */
+#include "test.hpp"
+
+#include <memory_view/similarity_search.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937 rng(90);
+
+    double score(const float* a, const float* b, std::size_t d, mv::metric m){
+        double dot = 0.0, aa = 0.0, bb = 0.0, l2 = 0.0;
+        for(std::size_t i = 0; i < d; i++){
+            const double x = static_cast<double>(a[i]), y = static_cast<double>(b[i]);
+            dot += x * y;
+            aa  += x * x;
+            bb  += y * y;
+            l2  += (x - y) * (x - y);
+        }
+        switch(m){
+        case mv::metric::l2:            return l2;
+        case mv::metric::inner_product: return dot;
+        case mv::metric::cosine:        return dot / std::sqrt(aa * bb);
+        default:                        return 0.0;
+        }
+    }
+
+    void check_search(std::size_t n, std::size_t queries, std::size_t d, std::size_t k, mv::metric m, std::size_t threads){
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        std::vector<float> base(n * d), query(queries * d);
+        for(auto& v : base)
+            v = dist(rng);
+        for(auto& v : query)
+            v = dist(rng);
+
+        std::vector<std::size_t> indices(queries * k);
+        std::vector<float> scores(queries * k);
+        mv::search(mv::matrix_view<const float>(base.data(), n, d), mv::matrix_view<const float>(query.data(), queries, d),
+                   k, m, mv::matrix_view<std::size_t>(indices.data(), queries, k), mv::matrix_view<float>(scores.data(), queries, k), threads);
+
+        for(std::size_t q = 0; q < queries; q++){
+            std::vector<std::pair<double, std::size_t>> all;
+            for(std::size_t i = 0; i < n; i++){
+                const double s = score(query.data() + q * d, base.data() + i * d, d, m);
+                all.emplace_back(m == mv::metric::l2 ? s : -s, i);
+            }
+            std::sort(all.begin(), all.end());
+            for(std::size_t i = 0; i < k; i++){
+                if(i < n){
+                    const double expected = m == mv::metric::l2 ? all[i].first : -all[i].first;
+                    CHECK(indices[q * k + i] == all[i].second);
+                    CHECK(std::fabs(static_cast<double>(scores[q * k + i]) - expected) <= 1e-4 * (1.0 + std::fabs(expected)));
+                }else{
+                    CHECK(indices[q * k + i] == std::numeric_limits<std::size_t>::max());
+                }
+            }
+        }
+    }
+}
+
+int main(){
+    for(auto m : {mv::metric::l2, mv::metric::inner_product, mv::metric::cosine}){
+        check_search(1000, 20, 33, 10, m, 1);
+        check_search(1000, 20, 128, 1, m, 3);
+        check_search(600, 17, 7, 25, m, 4);
+        check_search(5, 3, 16, 8, m, 2);
+    }
+
+    std::vector<float> a(8);
+    std::vector<std::size_t> i(4);
+    std::vector<float> s(4);
+    CHECK_THROWS(mv::search(mv::matrix_view<const float>(a.data(), 2, 4), mv::matrix_view<const float>(a.data(), 1, 4), 3, mv::metric::l2,
+                            mv::matrix_view<std::size_t>(i.data(), 1, 4), mv::matrix_view<float>(s.data(), 1, 4)));
+
+    return test::result();
+}
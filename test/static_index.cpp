@@ -0,0 +1,104 @@
+/**
+ * @file   memory_view/test/static_index.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  static_index against std::lower_bound and std::upper_bound
+ */
+#include "test.hpp"
+
+#include <memory_view/static_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    std::mt19937_64 rng(100);
+
+    template<typename K>
+    void check_index(std::size_t n){
+        using limits = std::numeric_limits<K>;
+        // the extreme keys are included, so the padding with max(K) is exercised
+        std::vector<K> keys(n);
+        for(auto& k : keys)
+            k = static_cast<K>(rng());
+        if(n > 0)
+            keys[0] = limits::min();
+        if(n > 1)
+            keys[1] = limits::max();
+        if(n > 2)
+            keys[2] = limits::max();
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<std::byte> buffer(mv::static_index<K>::bytes_required(n));
+        const auto index = mv::static_index<K>::build(mv::memory_view<const K>(keys), mv::memory_view<std::byte>(buffer));
+        CHECK(index.size() == n);
+
+        // the bytes are loaded again like a mapped file
+        const mv::static_index<K> loaded(index.data());
+        CHECK(loaded.size() == n);
+
+        std::vector<K> queries = {limits::min(), limits::max(), K{0}, static_cast<K>(limits::min() + 1), static_cast<K>(limits::max() - 1)};
+        for(std::size_t i = 0; i < n; i += 1 + n / 3000){
+            queries.push_back(keys[i]);
+            if(keys[i] != limits::max())
+                queries.push_back(static_cast<K>(keys[i] + 1));
+            if(keys[i] != limits::min())
+                queries.push_back(static_cast<K>(keys[i] - 1));
+        }
+        for(int i = 0; i < 200; i++)
+            queries.push_back(static_cast<K>(rng()));
+
+        for(K x : queries){
+            const auto lower = static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), x) - keys.begin());
+            const auto upper = static_cast<std::size_t>(std::upper_bound(keys.begin(), keys.end(), x) - keys.begin());
+            CHECK(loaded.lower_bound(x) == lower);
+            CHECK(loaded.upper_bound(x) == upper);
+            CHECK(loaded.find(x) == (lower < n && keys[lower] == x ? lower : mv::static_index<K>::npos));
+        }
+        for(std::size_t i = 0; i < n; i += 1 + n / 100)
+            CHECK(loaded.key(i) == keys[i]);
+    }
+
+    template<typename K>
+    void check_type(){
+        constexpr std::size_t keys = mv::static_index<K>::node_keys;
+        // sizes around full nodes and full layers
+        for(std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{3}, keys - 1, keys, keys + 1,
+                             keys * (keys + 1) - 1, keys * (keys + 1), keys * (keys + 1) + 1, std::size_t{1000}, std::size_t{70000}})
+            check_index<K>(n);
+    }
+}
+
+int main(){
+    check_type<std::int8_t>();
+    check_type<std::uint8_t>();
+    check_type<std::int16_t>();
+    check_type<std::uint16_t>();
+    check_type<std::int32_t>();
+    check_type<std::uint32_t>();
+    check_type<std::int64_t>();
+    check_type<std::uint64_t>();
+
+    // the loading constructor rejects other key types, other byte orders and short views
+    {
+        const std::vector<std::uint32_t> keys = {1, 2, 3};
+        std::vector<std::byte> buffer(mv::static_index<std::uint32_t>::bytes_required(keys.size()));
+        mv::static_index<std::uint32_t>::build(mv::memory_view<const std::uint32_t>(keys.data(), keys.size()), mv::memory_view<std::byte>(buffer));
+        const mv::memory_view<const std::byte> bytes(buffer.data(), buffer.size());
+        CHECK(mv::static_index<std::uint32_t>(bytes).find(2) == 1);
+        CHECK_THROWS(mv::static_index<std::int32_t>(bytes));
+        CHECK_THROWS(mv::static_index<std::uint64_t>(bytes));
+        CHECK_THROWS(mv::static_index<std::uint32_t>(bytes.first(bytes.size() - 1)));
+
+        std::byte* order = buffer.data() + offsetof(mv::impl::index_header, byte_order);
+        std::reverse(order, order + sizeof(std::uint64_t));
+        CHECK_THROWS(mv::static_index<std::uint32_t>(bytes));
+    }
+
+    return test::result();
+}
@@ -0,0 +1,161 @@
+/**
+ * @file   memory_view/test/tensor_view.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  reshape, broadcasting transforms and make_contiguous
+ */
+#include "test.hpp"
+
+#include <memory_view/tensor_view.hpp>
+
+#include <numeric>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    // element i of t in row major order
+    template<typename T>
+    T& at(const mv::tensor_view<T>& t, std::size_t i){
+        std::ptrdiff_t offset = 0;
+        for(std::size_t d = t.rank(); d-- > 0;){
+            offset += static_cast<std::ptrdiff_t>(i % t.shape(d)) * t.stride(d);
+            i /= t.shape(d);
+        }
+        return t.data()[offset];
+    }
+
+    template<typename T>
+    bool same_elements(const mv::tensor_view<T>& a, const mv::tensor_view<T>& b){
+        if(a.size() != b.size())
+            return false;
+        for(std::size_t i = 0; i < a.size(); i++)
+            if(&at(a, i) != &at(b, i))
+                return false;
+        return true;
+    }
+}
+
+int main(){
+    std::vector<float> data(2 * 3 * 4 * 5);
+    std::iota(data.begin(), data.end(), 0.0f);
+    const mv::tensor_view<float> nchw(mv::memory_view<float>(data), {2, 3, 4, 5});
+
+    // reshape of contiguous tensors and of size 1 dimensions
+    {
+        for(auto shape : {std::initializer_list<std::size_t>{120}, {6, 20}, {2, 60}, {1, 2, 1, 60, 1}, {2, 3, 20}, {4, 30}}){
+            const auto r = nchw.reshape(shape);
+            CHECK(r.has_value() && r->is_contiguous() && same_elements(nchw, *r));
+        }
+        const mv::tensor_view<float> ones(data.data(), {1, 4, 1, 3}, {999, 3, 7, 1});
+        for(auto shape : {std::initializer_list<std::size_t>{12}, {2, 1, 6}, {12, 1}, {1, 1, 4, 3}, {3, 4}}){
+            const auto r = ones.reshape(shape);
+            CHECK(r.has_value() && same_elements(ones, *r));
+        }
+        CHECK_THROWS(nchw.reshape({7, 7}));
+    }
+
+    // reshape of strided views, viewable where the merged dimensions are contiguous
+    {
+        const mv::tensor_view<float> rows(data.data(), {4, 6}, {12, 1});
+        const auto split = rows.reshape({2, 2, 3, 2});
+        CHECK(split.has_value() && same_elements(rows, *split));
+        CHECK(!rows.reshape({24}).has_value());
+        CHECK(!rows.reshape({3, 8}).has_value());
+
+        const auto nhwc = nchw.permute({0, 2, 3, 1});
+        CHECK(!nhwc.reshape({2, 60}).has_value());
+        const auto merged = nhwc.reshape({2, 20, 3});
+        CHECK(merged.has_value() && same_elements(nhwc, *merged));
+        const auto batch = nhwc.reshape({2, 4, 5, 3, 1});
+        CHECK(batch.has_value() && same_elements(nhwc, *batch));
+    }
+
+    // size 0 dimensions reshape to any shape without elements
+    {
+        const mv::tensor_view<float> empty(data.data(), {0, 3}, {3, 1});
+        const auto r = empty.reshape({3, 0, 5});
+        CHECK(r.has_value() && r->size() == 0 && r->rank() == 3);
+        CHECK_THROWS(empty.reshape({3}));
+    }
+
+    // broadcasting transforms, a per channel bias over NCHW and a strided output
+    {
+        std::vector<float> bias = {100.0f, 200.0f, 300.0f};
+        const mv::tensor_view<float> b(mv::memory_view<float>(bias), {3, 1, 1});
+        std::vector<float> out(data.size());
+        const mv::tensor_view<float> o(mv::memory_view<float>(out), {2, 3, 4, 5});
+        mv::transform(o, [](float x, float y){ return x + y; }, mv::tensor_view<const float>(nchw), mv::tensor_view<const float>(b));
+        for(std::size_t i = 0; i < out.size(); i++)
+            CHECK(out[i] == data[i] + bias[(i / 20) % 3]);
+
+        std::vector<float> nhwc(data.size());
+        const auto permuted = mv::tensor_view<float>(mv::memory_view<float>(nhwc), {2, 4, 5, 3}).permute({0, 3, 1, 2});
+        float scale = 2.0f;
+        const mv::tensor_view<float> s(&scale, {}, {});
+        mv::transform(permuted, [](float x, float y){ return x * y; }, mv::tensor_view<const float>(nchw), mv::tensor_view<const float>(s));
+        for(std::size_t i = 0; i < data.size(); i++)
+            CHECK(at(permuted, i) == 2.0f * data[i]);
+
+        CHECK_THROWS(mv::transform(o, [](float x){ return x; }, mv::tensor_view<const float>(data.data(), {4}, {1})));
+        const mv::tensor_view<float> none(data.data(), {2, 0}, {1, 1});
+        mv::transform(none, [](float){ return -1.0f; }, mv::tensor_view<const float>(b.data(), {1}, {0}));
+        CHECK(data[0] == 0.0f);
+    }
+
+    // collapsing merges dimensions all operands step through as one and drops size 1 dimensions
+    {
+        std::array<std::size_t, mv::max_rank> shape{2, 1, 3, 4};
+        std::array<std::array<std::ptrdiff_t, 2>, mv::max_rank> strides{};
+        strides[0] = {12, 0};
+        strides[1] = {12, 5};
+        strides[2] = {4, 0};
+        strides[3] = {1, 1};
+        const std::size_t r = mv::impl::collapse_dimensions<2>(4, shape, strides);
+        // the broadcast input steps through the first two dimensions as one
+        CHECK(r == 2);
+        CHECK(shape[0] == 6 && shape[1] == 4);
+        CHECK(strides[0][0] == 4 && strides[0][1] == 0);
+
+        std::array<std::size_t, mv::max_rank> flat{2, 3, 4};
+        std::array<std::array<std::ptrdiff_t, 2>, mv::max_rank> dense{};
+        dense[0] = {12, 12};
+        dense[1] = {4, 4};
+        dense[2] = {1, 1};
+        CHECK(mv::impl::collapse_dimensions<2>(3, flat, dense) == 1);
+        CHECK(flat[0] == 24 && dense[0][0] == 1);
+
+        std::array<std::size_t, mv::max_rank> single{1, 1};
+        std::array<std::array<std::ptrdiff_t, 2>, mv::max_rank> any{};
+        CHECK(mv::impl::collapse_dimensions<2>(2, single, any) == 1);
+        CHECK(single[0] == 1);
+    }
+
+    // make_contiguous through the tiled transpose and through the element wise fallback
+    {
+        std::vector<float> out(data.size());
+        const mv::tensor_view<float> nhwc(mv::memory_view<float>(out), {2, 4, 5, 3});
+        mv::make_contiguous(mv::tensor_view<const float>(nchw.permute({0, 2, 3, 1})), nhwc);
+        for(std::size_t n = 0; n < 2; n++)
+            for(std::size_t h = 0; h < 4; h++)
+                for(std::size_t w = 0; w < 5; w++)
+                    for(std::size_t c = 0; c < 3; c++)
+                        CHECK(nhwc(n, h, w, c) == nchw(n, c, h, w));
+
+        std::vector<float> back(data.size());
+        const mv::tensor_view<float> restored(mv::memory_view<float>(back), {2, 3, 4, 5});
+        mv::make_contiguous(mv::tensor_view<const float>(nhwc.permute({0, 3, 1, 2})), restored);
+        CHECK(back == data);
+
+        // every other element, not contiguous along any dimension
+        std::vector<float> half(data.size() / 2);
+        const mv::tensor_view<float> strided(data.data(), {6, 10}, {20, 2});
+        mv::make_contiguous(mv::tensor_view<const float>(strided), mv::tensor_view<float>(mv::memory_view<float>(half), {6, 10}));
+        for(std::size_t i = 0; i < half.size(); i++)
+            CHECK(half[i] == at(strided, i));
+
+        CHECK_THROWS(mv::make_contiguous(mv::tensor_view<const float>(nchw), nhwc));
+    }
+
+    return test::result();
+}
@@ -0,0 +1,42 @@
+/**
+ * @file   memory_view/test/test.hpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  minimal checks shared by the tests
+ */
+#ifndef MEMORY_VIEW_TEST_HPP
+#define MEMORY_VIEW_TEST_HPP
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace test{
+    inline int failures = 0;
+
+    inline void check(bool ok, const char* expression, const char* file, int line){
+        if(!ok){
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+            failures++;
+        }
+    }
+
+    // exit code of a test program
+    inline int result(){
+        return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+}
+
+#define CHECK(expression) ::test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#define CHECK_THROWS(expression)                                        \
+    do{                                                                 \
+        bool thrown = false;                                            \
+        try{                                                            \
+            (void)(expression);                                         \
+        }catch(const std::exception&){                                  \
+            thrown = true;                                              \
+        }                                                               \
+        ::test::check(thrown, "throws " #expression, __FILE__, __LINE__); \
+    }while(0)
+
+#endif /* MEMORY_VIEW_TEST_HPP */
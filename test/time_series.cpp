@@ -0,0 +1,104 @@
+/**
+ * @file   memory_view/test/time_series.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  time series round trips
+ */
+#include "test.hpp"
+
+#include <memory_view/time_series.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    bool same_bits(double a, double b){
+        return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+
+    // decode in batches of batch points and compare bit for bit
+    void check_round_trip(memory_view::memory_view<const std::uint8_t> chunk, const std::vector<std::int64_t>& timestamps,
+                          const std::vector<double>& values, std::size_t batch){
+        mv::series_decoder decoder(chunk);
+        CHECK(decoder.size() == timestamps.size());
+        std::vector<std::int64_t> t(batch);
+        std::vector<double> v(batch);
+        std::size_t i = 0;
+        while(decoder.remaining()){
+            const std::size_t n = decoder.decode(mv::memory_view<std::int64_t>(t), mv::memory_view<double>(v));
+            for(std::size_t k = 0; k < n; k++, i++){
+                CHECK(t[k] == timestamps[i]);
+                CHECK(same_bits(v[k], values[i]));
+            }
+        }
+        CHECK(i == timestamps.size());
+    }
+}
+
+int main(){
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::int64_t tmin = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t tmax = std::numeric_limits<std::int64_t>::max();
+
+    // special values and timestamp jumps through every delta of delta bucket
+    {
+        const std::vector<std::int64_t> timestamps = {1000, 1060, 1120, 1180, 1181, 1300, 1600, 5000, 5000, -7,
+                                                      tmax, tmin, 0, 1 << 20, (1 << 20) + 60, tmax - 1, tmax};
+        const std::vector<double> values = {1.0, 1.0, -0.0, 0.0, nan, nan, 1e300, -1e300, 1e-300, 3.25,
+                                            std::numeric_limits<double>::infinity(), 42.0, 42.5, 42.25, -nan, 0.1, 0.1};
+        std::vector<std::uint8_t> buffer(1024);
+        mv::series_encoder encoder{mv::memory_view<std::uint8_t>(buffer)};
+        for(std::size_t i = 0; i < timestamps.size(); i++)
+            CHECK(encoder.append(timestamps[i], values[i]));
+        CHECK(encoder.size() == timestamps.size());
+        for(std::size_t batch : {1, 3, 100})
+            check_round_trip(encoder.data(), timestamps, values, batch);
+
+        // the count is stored big endian
+        CHECK(buffer[0] == 0 && buffer[1] == 0 && buffer[2] == 0 && buffer[3] == timestamps.size());
+    }
+
+    // a full buffer rejects the point and leaves a valid chunk
+    {
+        std::mt19937 rng(96);
+        std::uniform_real_distribution<double> d(-1e6, 1e6);
+        std::vector<std::uint8_t> buffer(300);
+        mv::series_encoder encoder{mv::memory_view<std::uint8_t>(buffer)};
+        std::vector<std::int64_t> timestamps;
+        std::vector<double> values;
+        std::int64_t t = 1700000000;
+        for(;;){
+            t += 10 + static_cast<std::int64_t>(rng() % 3);
+            const double v = d(rng);
+            if(!encoder.append(t, v))
+                break;
+            timestamps.push_back(t);
+            values.push_back(v);
+        }
+        CHECK(!timestamps.empty());
+        CHECK(encoder.data().size() <= buffer.size());
+        // later points which fit are still appended after a rejected one
+        const bool small = encoder.append(t, values.back());
+        if(small){
+            timestamps.push_back(t);
+            values.push_back(values.back());
+        }
+        check_round_trip(encoder.data(), timestamps, values, 7);
+
+        CHECK_THROWS(mv::series_decoder(encoder.data().first(encoder.data().size() / 2)).decode(
+            mv::memory_view<std::int64_t>(timestamps), mv::memory_view<double>(values)));
+    }
+
+    CHECK_THROWS(mv::series_encoder(mv::memory_view<std::uint8_t>()));
+    {
+        const std::uint8_t header[4] = {0, 0, 1, 2};
+        CHECK(mv::series_decoder(mv::memory_view<const std::uint8_t>(header)).size() == 258);
+    }
+
+    return test::result();
+}
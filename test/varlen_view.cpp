@@ -0,0 +1,117 @@
+/**
+ * @file   memory_view/test/varlen_view.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  varlen_builder capacity limits and iteration of varlen_view
+ */
+#include "test.hpp"
+
+#include <memory_view/varlen_view.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    mv::memory_view<const char> as_view(const std::string& s){
+        return mv::memory_view<const char>(s.data(), s.size());
+    }
+
+    std::string as_string(mv::memory_view<const char> v){
+        return std::string(v.data(), v.size());
+    }
+}
+
+int main(){
+    const std::vector<std::string> words{"alpha", "", "be", "gamma delta", "", "e"};
+
+    // iteration, indexing and sub views against the appended strings
+    {
+        std::vector<char> data(64);
+        std::vector<std::uint32_t> offsets(words.size() + 1);
+        mv::varlen_builder builder(mv::memory_view<char>(data.data(), data.size()),
+                                   mv::memory_view<std::uint32_t>(offsets.data(), offsets.size()));
+        CHECK(builder.view().empty());
+        for(const auto& w : words)
+            CHECK(builder.append(as_view(w)));
+        CHECK(builder.size() == words.size());
+        CHECK(builder.nbytes() == 19);
+
+        const mv::varlen_view v = builder.view();
+        CHECK(v.size() == words.size());
+        CHECK(v.nbytes() == 19);
+        std::size_t i = 0;
+        for(auto element : v)
+            CHECK(as_string(element) == words[i++]);
+        CHECK(i == words.size());
+        CHECK(v.end() - v.begin() == static_cast<std::ptrdiff_t>(words.size()));
+        CHECK(as_string(v.front()) == "alpha" && as_string(v.back()) == "e");
+        CHECK(as_string(v.begin()[3]) == "gamma delta");
+        CHECK_THROWS(v.at(words.size()));
+
+        const mv::varlen_view sub = v.view(2, 2);
+        CHECK(sub.size() == 2);
+        CHECK(sub.nbytes() == 13);
+        CHECK(as_string(sub[0]) == "be" && as_string(sub[1]) == "gamma delta");
+        CHECK(v.view(4).size() == 2);
+        CHECK(v.view(words.size()).empty());
+        CHECK_THROWS(v.view(words.size() + 1));
+    }
+
+    // a full builder rejects the element and stays unchanged
+    {
+        std::vector<char> data(8);
+        std::vector<std::uint32_t> offsets(4);
+        mv::varlen_builder builder(mv::memory_view<char>(data.data(), data.size()),
+                                   mv::memory_view<std::uint32_t>(offsets.data(), offsets.size()));
+        CHECK(builder.append(as_view("abcde")));
+        CHECK(!builder.append(as_view("wxyz")));
+        CHECK(builder.size() == 1 && builder.nbytes() == 5);
+        CHECK(builder.append(as_view("xyz")));
+        CHECK(builder.nbytes() == 8);
+        // out of data, an empty element still fits
+        CHECK(!builder.append(as_view("q")));
+        CHECK(builder.append(as_view("")));
+        // out of offsets
+        CHECK(!builder.append(as_view("")));
+        CHECK(builder.size() == 3);
+        CHECK(as_string(builder.view()[1]) == "xyz");
+
+        builder.clear();
+        CHECK(builder.size() == 0 && builder.nbytes() == 0);
+        CHECK(builder.append(as_view("again")));
+        CHECK(as_string(builder.view().front()) == "again");
+    }
+
+    // the offset type limits the total size before the data buffer does
+    {
+        std::vector<char> data(300);
+        std::vector<std::uint8_t> offsets(10);
+        mv::basic_varlen_builder<std::uint8_t> builder(mv::memory_view<char>(data.data(), data.size()),
+                                                       mv::memory_view<std::uint8_t>(offsets.data(), offsets.size()));
+        const std::string chunk(100, 'x');
+        CHECK(builder.append(as_view(chunk)));
+        CHECK(builder.append(as_view(chunk)));
+        CHECK(!builder.append(as_view(chunk)));
+        CHECK(builder.append(as_view(std::string(55, 'y'))));
+        CHECK(!builder.append(as_view("z")));
+        CHECK(builder.view().nbytes() == 255);
+    }
+
+    // invalid buffers
+    {
+        std::vector<char> data(4);
+        CHECK_THROWS(mv::varlen_builder(mv::memory_view<char>(data.data(), data.size()), mv::memory_view<std::uint32_t>()));
+        const std::vector<std::uint32_t> past_end{0, 5};
+        CHECK_THROWS(mv::varlen_view(mv::memory_view<const char>(data.data(), data.size()),
+                                     mv::memory_view<const std::uint32_t>(past_end.data(), past_end.size())));
+        const std::vector<std::uint32_t> decreasing{3, 1};
+        CHECK_THROWS(mv::varlen_view(mv::memory_view<const char>(data.data(), data.size()),
+                                     mv::memory_view<const std::uint32_t>(decreasing.data(), decreasing.size())));
+        CHECK(mv::varlen_view(mv::memory_view<const char>(data.data(), data.size()), mv::memory_view<const std::uint32_t>()).empty());
+    }
+
+    return test::result();
+}
@@ -0,0 +1,89 @@
+/**
+ * @file   memory_view/test/window.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  sliding window aggregates against a naive reference
+ */
+#include "test.hpp"
+
+#include <memory_view/window.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    struct reference{
+        double sum, mean, variance;
+        float min, max;
+    };
+
+    reference naive(const std::vector<float>& x, std::size_t i, std::size_t window){
+        const std::size_t begin = i + 1 < window ? 0 : i + 1 - window;
+        const double n = static_cast<double>(i + 1 - begin);
+        reference r{0.0, 0.0, 0.0, x[begin], x[begin]};
+        for(std::size_t j = begin; j <= i; j++){
+            r.sum += static_cast<double>(x[j]);
+            r.min = std::min(r.min, x[j]);
+            r.max = std::max(r.max, x[j]);
+        }
+        r.mean = r.sum / n;
+        for(std::size_t j = begin; j <= i; j++)
+            r.variance += (static_cast<double>(x[j]) - r.mean) * (static_cast<double>(x[j]) - r.mean);
+        r.variance /= n;
+        return r;
+    }
+
+    bool close(float a, double b){
+        return std::fabs(static_cast<double>(a) - b) <= 1e-4 * (1.0 + std::fabs(b));
+    }
+}
+
+int main(){
+    std::mt19937 rng(97);
+    std::uniform_real_distribution<float> d(-10.0f, 10.0f);
+    std::vector<float> x(1000);
+    for(auto& v : x)
+        v = d(rng);
+
+    for(std::size_t window : {1, 2, 7, 64, 2000}){
+        mv::window_sum      sum(window);
+        mv::window_mean     mean(window);
+        mv::window_variance variance(window);
+        mv::window_min      min(window);
+        mv::window_max      max(window);
+        std::vector<float> s(x.size()), m(x.size()), v(x.size()), lo(x.size()), hi(x.size());
+
+        // several batches of different sizes form one stream
+        for(std::size_t begin = 0, batch = 1; begin < x.size(); begin += batch, batch = batch * 3 + 1){
+            const std::size_t n = std::min(batch, x.size() - begin);
+            const mv::memory_view<const float> in(x.data() + begin, n);
+            sum.process(in, mv::memory_view<float>(s.data() + begin, n));
+            mean.process(in, mv::memory_view<float>(m.data() + begin, n));
+            variance.process(in, mv::memory_view<float>(v.data() + begin, n));
+            min.process(in, mv::memory_view<float>(lo.data() + begin, n));
+            max.process(in, mv::memory_view<float>(hi.data() + begin, n));
+        }
+
+        for(std::size_t i = 0; i < x.size(); i++){
+            const reference r = naive(x, i, window);
+            CHECK(close(s[i], r.sum));
+            CHECK(close(m[i], r.mean));
+            CHECK(close(v[i], r.variance));
+            CHECK(lo[i] == r.min);
+            CHECK(hi[i] == r.max);
+        }
+    }
+
+    CHECK_THROWS(mv::window_sum(0));
+    {
+        mv::window_mean mean(4);
+        float out[2];
+        CHECK_THROWS(mean.process(mv::memory_view<const float>(x.data(), 3), mv::memory_view<float>(out)));
+    }
+
+    return test::result();
+}
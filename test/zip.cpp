@@ -0,0 +1,99 @@
+/**
+ * @file   memory_view/test/zip.cpp
+ * @author Peter Züger
+ * @date   18.10.2026
+ * @brief  block iteration over zipped views
+ */
+#include "test.hpp"
+
+#include <memory_view/zip.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mv = memory_view;
+
+namespace{
+    struct pixel{
+        std::uint8_t r, g, b;
+    };
+
+    struct word{
+        std::uint8_t bytes[4];
+    };
+
+    struct point{
+        float x, y, z;
+    };
+
+    bool aligned(const void* p, std::size_t alignment){
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+
+    // the blocks cover the views in order, every block after the first starts aligned if one element is
+    template<typename T>
+    std::vector<std::size_t> blocks(T* first, std::size_t n, std::size_t block_size, std::size_t alignment, bool reachable){
+        std::vector<int> other(n);
+        const auto zip = mv::zip(mv::memory_view<T>(first, n), mv::memory_view<int>(other));
+        std::vector<std::size_t> sizes;
+        std::size_t next = 0;
+        zip.for_each_block(block_size, [&](auto a, auto b){
+            CHECK(a.size() == b.size());
+            CHECK(a.data() == first + next);
+            CHECK(b.data() == other.data() + next);
+            if(!sizes.empty() && reachable)
+                CHECK(aligned(a.data(), alignment));
+            next += a.size();
+            sizes.push_back(a.size());
+        }, alignment);
+        CHECK(next == n);
+        return sizes;
+    }
+}
+
+int main(){
+    // 8 floats are rounded up to 16 for 64 byte alignment
+    {
+        alignas(64) float a[200];
+        for(std::size_t offset = 0; offset < 16; offset++){
+            const auto sizes = blocks(a + offset, 200 - offset, 8, 64, true);
+            const std::size_t head = (16 - offset) % 16;
+            CHECK(sizes.front() == (head == 0 ? 16 : head));
+            for(std::size_t i = 1; i + 1 < sizes.size(); i++)
+                CHECK(sizes[i] == 16);
+            CHECK(blocks(a + offset, 200 - offset, 8, 0, false).front() == 8);
+            CHECK(blocks(a + offset, 200 - offset, 32, 64, true).size() <= 8);
+        }
+        CHECK_THROWS(mv::zip(mv::memory_view<float>(a)).for_each_block(0, [](auto){}));
+    }
+
+    // 12 byte elements reach a 16 byte boundary every 4 elements, from every 4 byte aligned address
+    {
+        alignas(16) point p[80];
+        for(std::size_t offset = 0; offset < 4; offset++){
+            const auto sizes = blocks(p + offset, 60, 5, 16, true);
+            CHECK(sizes.front() == (offset == 0 ? 8 : 4 - offset));
+        }
+    }
+
+    // 3 byte elements reach a 16 byte boundary within 16 elements
+    {
+        alignas(16) pixel p[100];
+        for(std::size_t offset = 0; offset < 16; offset++)
+            blocks(p + offset, 70, 4, 16, true);
+    }
+
+    // no element of a 4 byte type is aligned from an odd address, the blocks stay as they are
+    {
+        alignas(16) word w[50];
+        const auto* odd = reinterpret_cast<const word*>(reinterpret_cast<const std::uint8_t*>(w) + 1);
+        std::size_t next = 0;
+        mv::zip(mv::memory_view<const word>(odd, 40)).for_each_block(6, [&](auto a){
+            CHECK(a.size() == std::min<std::size_t>(6, 40 - next));
+            next += a.size();
+        }, 16);
+        CHECK(next == 40);
+    }
+
+    return test::result();
+}